@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "async-log-backend.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <ostream>
+
+namespace nfd {
+
+const time::milliseconds AsyncLogBackend::DRAIN_INTERVAL = 1_ms;
+
+std::atomic<AsyncLogBackend*> AsyncLogBackend::s_instance{nullptr};
+std::atomic<uint64_t> AsyncLogBackend::s_lastId{0};
+
+AsyncLogBackend::AsyncLogBackend(size_t ringCapacity, std::ostream& os)
+  : m_id(++s_lastId)
+  , m_ringCapacity(ringCapacity)
+  , m_os(os)
+{
+  BOOST_ASSERT(ringCapacity > 0);
+
+  AsyncLogBackend* expected = nullptr;
+  if (!s_instance.compare_exchange_strong(expected, this)) {
+    BOOST_THROW_EXCEPTION(std::logic_error("another AsyncLogBackend is active"));
+  }
+
+  m_drainThread = std::thread([this] { this->drainLoop(); });
+}
+
+AsyncLogBackend::~AsyncLogBackend()
+{
+  this->stop();
+}
+
+void
+AsyncLogBackend::stop()
+{
+  if (!m_drainThread.joinable()) {
+    return;
+  }
+
+  AsyncLogBackend* expected = this;
+  s_instance.compare_exchange_strong(expected, nullptr);
+
+  m_shouldStop.store(true, std::memory_order_release);
+  m_drainThread.join();
+}
+
+std::ostringstream&
+AsyncLogBackend::getThreadStream()
+{
+  static thread_local std::ostringstream os;
+  return os;
+}
+
+std::ostream&
+AsyncLogBackend::beginMessage()
+{
+  std::ostringstream& os = getThreadStream();
+  os.str("");
+  os.clear();
+  return os;
+}
+
+void
+AsyncLogBackend::submit(ndn::util::LogLevel level, const std::string& module)
+{
+  AsyncLogBackend* self = s_instance.load(std::memory_order_acquire);
+  if (self == nullptr) {
+    // stopped after isActive() was checked
+    return;
+  }
+
+  Record record{time::system_clock::now(), level, &module, getThreadStream().str()};
+  if (!self->getThreadRing().push(std::move(record))) {
+    self->m_nDropped.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+AsyncLogBackend::Ring&
+AsyncLogBackend::getThreadRing()
+{
+  static thread_local uint64_t ownerId = 0;
+  static thread_local Ring* ring = nullptr;
+
+  if (ownerId != m_id) {
+    std::lock_guard<std::mutex> lock(m_ringsMutex);
+    m_rings.push_back(make_unique<Ring>(m_ringCapacity));
+    ring = m_rings.back().get();
+    ownerId = m_id;
+  }
+  return *ring;
+}
+
+void
+AsyncLogBackend::drainLoop()
+{
+  while (!m_shouldStop.load(std::memory_order_acquire)) {
+    if (this->drainOnce() == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(DRAIN_INTERVAL.count()));
+    }
+  }
+
+  // write messages submitted before stop()
+  while (this->drainOnce() > 0) {
+  }
+}
+
+size_t
+AsyncLogBackend::drainOnce()
+{
+  size_t nWritten = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_ringsMutex);
+    Record record;
+    for (const auto& ring : m_rings) {
+      while (ring->pop(record)) {
+        this->writeRecord(record);
+        ++nWritten;
+      }
+    }
+  }
+
+  uint64_t nDropped = m_nDropped.load(std::memory_order_relaxed);
+  if (nDropped != m_nReportedDrops) {
+    Record report{time::system_clock::now(), ndn::util::LogLevel::WARN, nullptr,
+                  to_string(nDropped - m_nReportedDrops) + " log messages dropped"};
+    this->writeRecord(report);
+    m_nReportedDrops = nDropped;
+  }
+
+  m_os.flush();
+  return nWritten;
+}
+
+void
+AsyncLogBackend::writeRecord(const Record& record)
+{
+  static const std::string ownModule = "nfd.AsyncLogBackend";
+
+  // same layout as ndn-cxx log records
+  auto usecs = time::duration_cast<time::microseconds>(record.timestamp.time_since_epoch()).count();
+  char timestamp[32];
+  std::snprintf(timestamp, sizeof(timestamp), "%" PRId64 ".%06" PRId64,
+                static_cast<int64_t>(usecs / 1000000), static_cast<int64_t>(usecs % 1000000));
+
+  m_os << timestamp << ' ' << record.level << ": ["
+       << (record.module == nullptr ? ownModule : *record.module) << "] "
+       << record.message << '\n';
+}
+
+} // namespace nfd
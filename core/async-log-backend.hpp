@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_ASYNC_LOG_BACKEND_HPP
+#define NFD_CORE_ASYNC_LOG_BACKEND_HPP
+
+#include "common.hpp"
+#include "spsc-ring.hpp"
+
+#include <ndn-cxx/util/logger.hpp>
+
+#include <atomic>
+#include <iosfwd>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace nfd {
+
+/** \brief writes log messages from a background thread
+ *
+ *  While an instance exists, NFD_LOG_* statements whose level is enabled format their message
+ *  on the calling thread, and append it to a bounded lock-free ring owned by that thread.
+ *  A drain thread writes queued messages to the output stream. When a ring is full, the
+ *  message is dropped and counted; the drain thread periodically reports the drop count.
+ *
+ *  At most one instance may exist at a time, and it must outlive all threads that log.
+ */
+class AsyncLogBackend : noncopyable
+{
+public:
+  /** \param ringCapacity max number of queued messages per logging thread
+   *  \param os output stream; must outlive this instance
+   */
+  explicit
+  AsyncLogBackend(size_t ringCapacity, std::ostream& os);
+
+  ~AsyncLogBackend();
+
+  /** \brief stops the drain thread after writing all queued messages
+   *
+   *  Log statements executed afterwards use the synchronous ndn-cxx backend.
+   */
+  void
+  stop();
+
+  /** \return number of messages dropped because a ring was full
+   */
+  uint64_t
+  getNDropped() const
+  {
+    return m_nDropped.load(std::memory_order_relaxed);
+  }
+
+  /** \return whether log statements should be submitted to the background thread
+   */
+  static bool
+  isActive()
+  {
+    return s_instance.load(std::memory_order_relaxed) != nullptr;
+  }
+
+  /** \return a reset per-thread stream for formatting a message
+   */
+  static std::ostream&
+  beginMessage();
+
+  /** \brief queues the message formatted in beginMessage() stream
+   *  \param module logger name; must outlive the backend
+   */
+  static void
+  submit(ndn::util::LogLevel level, const std::string& module);
+
+public:
+  /** \brief interval at which the drain thread polls the rings when they are all empty
+   */
+  static const time::milliseconds DRAIN_INTERVAL;
+
+private:
+  struct Record
+  {
+    time::system_clock::TimePoint timestamp;
+    ndn::util::LogLevel level;
+    const std::string* module;
+    std::string message;
+  };
+
+  using Ring = SpscRing<Record>;
+
+  static std::ostringstream&
+  getThreadStream();
+
+  /** \return the ring of the calling thread, which is created upon first use
+   */
+  Ring&
+  getThreadRing();
+
+  void
+  drainLoop();
+
+  /** \return number of messages written
+   */
+  size_t
+  drainOnce();
+
+  void
+  writeRecord(const Record& record);
+
+private:
+  static std::atomic<AsyncLogBackend*> s_instance;
+  static std::atomic<uint64_t> s_lastId;
+
+  const uint64_t m_id; ///< distinguishes from earlier instances in thread-local ring cache
+  const size_t m_ringCapacity;
+  std::ostream& m_os;
+
+  std::mutex m_ringsMutex;
+  std::vector<unique_ptr<Ring>> m_rings;
+
+  std::atomic<uint64_t> m_nDropped{0};
+  uint64_t m_nReportedDrops = 0;
+
+  std::atomic<bool> m_shouldStop{false};
+  std::thread m_drainThread;
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_ASYNC_LOG_BACKEND_HPP
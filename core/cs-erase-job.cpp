@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-erase-job.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+namespace nfd {
+
+CsEraseStartCommand::CsEraseStartCommand()
+  : ControlCommand("cs", "erase-start")
+{
+  m_requestValidator
+    .required(ndn::nfd::CONTROL_PARAMETER_NAME);
+  m_responseValidator
+    .required(ndn::nfd::CONTROL_PARAMETER_NAME)
+    .required(ndn::nfd::CONTROL_PARAMETER_COUNT);
+}
+
+CsEraseCancelCommand::CsEraseCancelCommand()
+  : ControlCommand("cs", "erase-cancel")
+{
+  m_requestValidator
+    .required(ndn::nfd::CONTROL_PARAMETER_NAME);
+  m_responseValidator
+    .required(ndn::nfd::CONTROL_PARAMETER_NAME)
+    .required(ndn::nfd::CONTROL_PARAMETER_COUNT);
+}
+
+CsEraseJob::CsEraseJob()
+  : m_nErased(0)
+{
+}
+
+CsEraseJob::CsEraseJob(const Block& block)
+{
+  this->wireDecode(block);
+}
+
+template<ndn::encoding::Tag TAG>
+size_t
+CsEraseJob::wireEncode(ndn::encoding::EncodingImpl<TAG>& encoder) const
+{
+  size_t totalLength = 0;
+
+  totalLength += ndn::encoding::prependNonNegativeIntegerBlock(encoder, TLV_N_ERASED, m_nErased);
+  totalLength += m_name.wireEncode(encoder);
+
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(TLV_CS_ERASE_JOB);
+  return totalLength;
+}
+
+template size_t
+CsEraseJob::wireEncode<ndn::encoding::EncoderTag>(ndn::EncodingBuffer&) const;
+
+template size_t
+CsEraseJob::wireEncode<ndn::encoding::EstimatorTag>(ndn::EncodingEstimator&) const;
+
+const Block&
+CsEraseJob::wireEncode() const
+{
+  if (m_wire.hasWire()) {
+    return m_wire;
+  }
+
+  ndn::EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  ndn::EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  m_wire = buffer.block();
+  return m_wire;
+}
+
+void
+CsEraseJob::wireDecode(const Block& block)
+{
+  if (block.type() != TLV_CS_ERASE_JOB) {
+    BOOST_THROW_EXCEPTION(Error("expecting CsEraseJob, but TLV-TYPE is " + to_string(block.type())));
+  }
+  m_wire = block;
+  m_wire.parse();
+  auto val = m_wire.elements_begin();
+
+  if (val != m_wire.elements_end() && val->type() == ndn::tlv::Name) {
+    m_name.wireDecode(*val);
+    ++val;
+  }
+  else {
+    BOOST_THROW_EXCEPTION(Error("missing required Name field"));
+  }
+
+  if (val != m_wire.elements_end() && val->type() == TLV_N_ERASED) {
+    m_nErased = ndn::encoding::readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    BOOST_THROW_EXCEPTION(Error("missing required NErased field"));
+  }
+}
+
+CsEraseJob&
+CsEraseJob::setName(const Name& name)
+{
+  m_wire.reset();
+  m_name = name;
+  return *this;
+}
+
+CsEraseJob&
+CsEraseJob::setNErased(uint64_t nErased)
+{
+  m_wire.reset();
+  m_nErased = nErased;
+  return *this;
+}
+
+bool
+operator==(const CsEraseJob& a, const CsEraseJob& b)
+{
+  return a.getName() == b.getName() &&
+         a.getNErased() == b.getNErased();
+}
+
+std::ostream&
+operator<<(std::ostream& os, const CsEraseJob& job)
+{
+  return os << "CsEraseJob(Name: " << job.getName()
+            << ", NErased: " << job.getNErased()
+            << ")";
+}
+
+} // namespace nfd
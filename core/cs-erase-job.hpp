@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_CS_ERASE_JOB_HPP
+#define NFD_CORE_CS_ERASE_JOB_HPP
+
+#include "common.hpp"
+
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+#include <ndn-cxx/mgmt/nfd/control-command.hpp>
+
+namespace nfd {
+
+/** \brief represents a cs/erase-start command
+ *
+ *  It starts a background job that erases all Data under Name. The response carries
+ *  Name and Count, the number of Data erased so far if the job was already running.
+ */
+class CsEraseStartCommand : public ndn::nfd::ControlCommand
+{
+public:
+  CsEraseStartCommand();
+};
+
+/** \brief represents a cs/erase-cancel command
+ *
+ *  It cancels the background erase job for Name. The response carries Name and Count,
+ *  the number of Data erased by the job.
+ */
+class CsEraseCancelCommand : public ndn::nfd::ControlCommand
+{
+public:
+  CsEraseCancelCommand();
+};
+
+/** \brief represents an item in cs/erase-jobs dataset
+ *
+ *  CsEraseJob := CS-ERASE-JOB-TYPE TLV-LENGTH
+ *                  Name
+ *                  NErased
+ *
+ *  The TLV-TYPE numbers are not assigned to CsInfo or other datasets under
+ *  /localhost/nfd/cs.
+ */
+class CsEraseJob
+{
+public:
+  class Error : public ndn::tlv::Error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : ndn::tlv::Error(what)
+    {
+    }
+  };
+
+  enum : uint32_t {
+    TLV_CS_ERASE_JOB = 0xD8,
+    TLV_N_ERASED = 0xD9,
+  };
+
+  CsEraseJob();
+
+  explicit
+  CsEraseJob(const Block& block);
+
+  template<ndn::encoding::Tag TAG>
+  size_t
+  wireEncode(ndn::encoding::EncodingImpl<TAG>& encoder) const;
+
+  const Block&
+  wireEncode() const;
+
+  void
+  wireDecode(const Block& wire);
+
+public: // getters & setters
+  /** \brief get the name prefix of the job
+   */
+  const Name&
+  getName() const
+  {
+    return m_name;
+  }
+
+  CsEraseJob&
+  setName(const Name& name);
+
+  /** \brief get the number of Data erased so far
+   */
+  uint64_t
+  getNErased() const
+  {
+    return m_nErased;
+  }
+
+  CsEraseJob&
+  setNErased(uint64_t nErased);
+
+private:
+  Name m_name;
+  uint64_t m_nErased;
+
+  mutable Block m_wire;
+};
+
+bool
+operator==(const CsEraseJob& a, const CsEraseJob& b);
+
+inline bool
+operator!=(const CsEraseJob& a, const CsEraseJob& b)
+{
+  return !(a == b);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const CsEraseJob& job);
+
+} // namespace nfd
+
+#endif // NFD_CORE_CS_ERASE_JOB_HPP
@@ -0,0 +1,62 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "latency-histogram.hpp"
+
+#include <cmath>
+
+namespace nfd {
+
+constexpr size_t LatencyHistogram::N_BUCKETS;
+constexpr uint64_t LatencyHistogram::SAMPLE_INTERVAL;
+
+uint64_t
+LatencyHistogram::getQuantile(const uint64_t* buckets, size_t nBuckets, uint64_t count, double q)
+{
+  if (count == 0 || nBuckets == 0) {
+    return 0;
+  }
+
+  uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * count)));
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < nBuckets; ++i) {
+    cumulative += buckets[i];
+    if (cumulative >= rank) {
+      return getBucketUpperBound(i);
+    }
+  }
+  return getBucketUpperBound(nBuckets - 1);
+}
+
+void
+LatencyHistogram::reset()
+{
+  m_buckets.fill(0);
+  m_count = 0;
+  m_total = 0;
+  m_nInvocations = 0;
+}
+
+} // namespace nfd
@@ -0,0 +1,200 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_LATENCY_HISTOGRAM_HPP
+#define NFD_CORE_LATENCY_HISTOGRAM_HPP
+
+#include "common.hpp"
+
+#include <array>
+#include <chrono>
+
+namespace nfd {
+
+/** \brief histogram of processing latencies with power-of-two buckets
+ *
+ *  Bucket i counts samples in [2^i, 2^(i+1)) nanoseconds; bucket 0 also counts zero,
+ *  and the last bucket also counts every longer sample.
+ *  Recording a sample is a few integer operations and never allocates.
+ */
+class LatencyHistogram : noncopyable
+{
+public:
+  /** \brief clock used to measure latency
+   *
+   *  This is a wall clock rather than time::steady_clock, which is simulated time in ndnSIM.
+   */
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr size_t N_BUCKETS = 32;
+
+  /** \brief one in SAMPLE_INTERVAL invocations is timed
+   *  \note must be a power of two
+   */
+  static constexpr uint64_t SAMPLE_INTERVAL = 16;
+
+  /** \brief decide whether the current invocation should be timed
+   */
+  bool
+  shouldSample()
+  {
+    return (m_nInvocations++ & (SAMPLE_INTERVAL - 1)) == 0;
+  }
+
+  /** \brief record a sample
+   */
+  void
+  add(uint64_t nanoseconds)
+  {
+    ++m_buckets[getBucketIndex(nanoseconds)];
+    ++m_count;
+    m_total += nanoseconds;
+  }
+
+  /** \return number of recorded samples
+   */
+  uint64_t
+  getCount() const
+  {
+    return m_count;
+  }
+
+  /** \return sum of recorded samples, in nanoseconds
+   */
+  uint64_t
+  getTotal() const
+  {
+    return m_total;
+  }
+
+  const std::array<uint64_t, N_BUCKETS>&
+  getBuckets() const
+  {
+    return m_buckets;
+  }
+
+  /** \return an upper bound of quantile \p q of recorded samples, in nanoseconds
+   *  \param q quantile, in [0.0, 1.0]
+   *  \retval 0 no sample has been recorded
+   */
+  uint64_t
+  getQuantile(double q) const
+  {
+    return getQuantile(m_buckets.data(), m_buckets.size(), m_count, q);
+  }
+
+  /** \return an upper bound of quantile \p q of \p count samples in \p buckets, in nanoseconds
+   *
+   *  \p buckets may omit trailing empty buckets, as in the status/latency dataset.
+   *  \retval 0 there is no sample
+   */
+  static uint64_t
+  getQuantile(const uint64_t* buckets, size_t nBuckets, uint64_t count, double q);
+
+  void
+  reset();
+
+  static size_t
+  getBucketIndex(uint64_t nanoseconds)
+  {
+    if (nanoseconds < 2) {
+      return 0;
+    }
+    size_t msb = 63 - __builtin_clzll(nanoseconds);
+    return std::min(msb, N_BUCKETS - 1);
+  }
+
+  /** \return exclusive upper bound of bucket \p index, in nanoseconds
+   */
+  static uint64_t
+  getBucketUpperBound(size_t index)
+  {
+    return uint64_t(1) << (index + 1);
+  }
+
+private:
+  std::array<uint64_t, N_BUCKETS> m_buckets{};
+  uint64_t m_count = 0;
+  uint64_t m_total = 0;
+  uint64_t m_nInvocations = 0;
+};
+
+/** \brief times a scope into a LatencyHistogram
+ *
+ *  Only invocations selected by LatencyHistogram::shouldSample read the clock.
+ *  When NFD is configured with --without-latency-histograms, this type does nothing
+ *  and is optimized away.
+ */
+class ScopedLatencySample : noncopyable
+{
+public:
+#ifdef DISABLE_LATENCY_HISTOGRAMS
+  explicit
+  ScopedLatencySample(LatencyHistogram&)
+  {
+  }
+
+  void
+  stop()
+  {
+  }
+#else
+  explicit
+  ScopedLatencySample(LatencyHistogram& histogram)
+    : m_histogram(histogram.shouldSample() ? &histogram : nullptr)
+  {
+    if (m_histogram != nullptr) {
+      m_start = LatencyHistogram::Clock::now();
+    }
+  }
+
+  ~ScopedLatencySample()
+  {
+    this->stop();
+  }
+
+  /** \brief record the sample now instead of at the end of scope
+   *
+   *  Calling stop more than once has no effect.
+   */
+  void
+  stop()
+  {
+    if (m_histogram != nullptr) {
+      auto elapsed = LatencyHistogram::Clock::now() - m_start;
+      m_histogram->add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+      m_histogram = nullptr;
+    }
+  }
+
+private:
+  LatencyHistogram* m_histogram;
+  LatencyHistogram::Clock::time_point m_start;
+#endif // DISABLE_LATENCY_HISTOGRAMS
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_LATENCY_HISTOGRAM_HPP
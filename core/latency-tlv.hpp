@@ -0,0 +1,59 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_LATENCY_TLV_HPP
+#define NFD_CORE_LATENCY_TLV_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+namespace latency_tlv {
+
+/** \brief TLV-TYPE numbers of status/latency dataset, shared by NFD and nfdc
+ *
+ *  PipelineStageLatency := PIPELINE-STAGE-LATENCY-TYPE TLV-LENGTH
+ *                            StageName
+ *                            NSamples
+ *                            TotalNanoseconds
+ *                            BucketCount*
+ *
+ *  BucketCount i is the number of samples in [2^i, 2^(i+1)) nanoseconds;
+ *  trailing empty buckets are omitted.
+ *
+ *  These numbers are not assigned to ForwarderStatus or other datasets under
+ *  /localhost/nfd/status.
+ */
+enum : uint32_t {
+  PipelineStageLatency = 0xD0,
+  StageName            = 0xD1,
+  NSamples             = 0xD2,
+  TotalNanoseconds     = 0xD3,
+  BucketCount          = 0xD4,
+};
+
+} // namespace latency_tlv
+} // namespace nfd
+
+#endif // NFD_CORE_LATENCY_TLV_HPP
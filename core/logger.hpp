@@ -26,19 +26,75 @@
 #ifndef NFD_CORE_LOGGER_HPP
 #define NFD_CORE_LOGGER_HPP
 
+#include "core/async-log-backend.hpp"
+
 #include <ndn-cxx/util/logger.hpp>
 
+#include <sstream>
+
 #define NFD_LOG_INIT(name)                         NDN_LOG_INIT(nfd.name)
 #define NFD_LOG_MEMBER_DECL()                      NDN_LOG_MEMBER_DECL()
 #define NFD_LOG_MEMBER_DECL_SPECIALIZED(cls)       NDN_LOG_MEMBER_DECL_SPECIALIZED(cls)
 #define NFD_LOG_MEMBER_INIT(cls, name)             NDN_LOG_MEMBER_INIT(cls, nfd.name)
 #define NFD_LOG_MEMBER_INIT_SPECIALIZED(cls, name) NDN_LOG_MEMBER_INIT_SPECIALIZED(cls, nfd.name)
 
-#define NFD_LOG_TRACE NDN_LOG_TRACE
-#define NFD_LOG_DEBUG NDN_LOG_DEBUG
-#define NFD_LOG_INFO  NDN_LOG_INFO
-#define NFD_LOG_WARN  NDN_LOG_WARN
-#define NFD_LOG_ERROR NDN_LOG_ERROR
-#define NFD_LOG_FATAL NDN_LOG_FATAL
+/** \brief most verbose level whose log statements are compiled
+ *
+ *  5 is TRACE, 4 is DEBUG, 3 is INFO. Statements of more verbose levels are compiled out,
+ *  so that they cost nothing even when the runtime level check would have rejected them.
+ *  This is set with './waf configure --with-max-log-level=LEVEL'.
+ */
+#ifndef LOG_MAX_LEVEL
+#define LOG_MAX_LEVEL 5
+#endif
+
+/** \brief log statement of an enabled level
+ *
+ *  The message is handed to AsyncLogBackend when it is active,
+ *  otherwise it is written synchronously by ndn-cxx.
+ */
+#define NFD_LOG_INTERNAL(lvl, expression) \
+  do { \
+    if (ndn_cxx_getLogger().isLevelEnabled(::ndn::util::LogLevel::lvl)) { \
+      if (::nfd::AsyncLogBackend::isActive()) { \
+        ::nfd::AsyncLogBackend::beginMessage() << expression; \
+        ::nfd::AsyncLogBackend::submit(::ndn::util::LogLevel::lvl, \
+                                       ndn_cxx_getLogger().getModuleName()); \
+      } \
+      else { \
+        NDN_LOG_##lvl(expression); \
+      } \
+    } \
+  } while (false)
+
+/** \brief log statement of a compiled-out level
+ *
+ *  The expression is still type-checked, so that variables used only in logging
+ *  do not trigger warnings, but no code is generated.
+ */
+#define NFD_LOG_COMPILED_OUT(expression) \
+  do { \
+    if (false) { \
+      ::std::ostringstream nfd_log_os; \
+      nfd_log_os << expression; \
+    } \
+  } while (false)
+
+#if LOG_MAX_LEVEL >= 5
+#define NFD_LOG_TRACE(expression) NFD_LOG_INTERNAL(TRACE, expression)
+#else
+#define NFD_LOG_TRACE(expression) NFD_LOG_COMPILED_OUT(expression)
+#endif
+
+#if LOG_MAX_LEVEL >= 4
+#define NFD_LOG_DEBUG(expression) NFD_LOG_INTERNAL(DEBUG, expression)
+#else
+#define NFD_LOG_DEBUG(expression) NFD_LOG_COMPILED_OUT(expression)
+#endif
+
+#define NFD_LOG_INFO(expression)  NFD_LOG_INTERNAL(INFO, expression)
+#define NFD_LOG_WARN(expression)  NFD_LOG_INTERNAL(WARN, expression)
+#define NFD_LOG_ERROR(expression) NFD_LOG_INTERNAL(ERROR, expression)
+#define NFD_LOG_FATAL(expression) NFD_LOG_INTERNAL(FATAL, expression)
 
 #endif // NFD_CORE_LOGGER_HPP
@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_SPSC_RING_HPP
+#define NFD_CORE_SPSC_RING_HPP
+
+#include "common.hpp"
+
+#include <atomic>
+
+namespace nfd {
+
+/** \brief a bounded lock-free queue between a single producer thread and a single consumer thread
+ *
+ *  push() may be invoked from one thread while pop() is invoked from another thread,
+ *  without locking. Each side caches the other side's index, so that the shared indices
+ *  are read only when the ring appears full or empty.
+ *  \tparam T element type; must be default-constructible and move-assignable
+ */
+template<typename T>
+class SpscRing : noncopyable
+{
+public:
+  /** \param capacity max number of elements; rounded up to a power of two
+   */
+  explicit
+  SpscRing(size_t capacity)
+    : m_mask(roundUpToPowerOfTwo(capacity) - 1)
+    , m_slots(m_mask + 1)
+  {
+  }
+
+  size_t
+  capacity() const
+  {
+    return m_mask + 1;
+  }
+
+  /** \return number of elements; exact only when neither side is running
+   */
+  size_t
+  size() const
+  {
+    size_t head = m_head.load(std::memory_order_acquire);
+    return m_tail.load(std::memory_order_acquire) - head;
+  }
+
+  /** \brief appends an element; must be invoked by the producer only
+   *  \retval false the ring is full, and \p item is not moved from
+   */
+  bool
+  push(T&& item)
+  {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_cachedHead == this->capacity()) {
+      m_cachedHead = m_head.load(std::memory_order_acquire);
+      if (tail - m_cachedHead == this->capacity()) {
+        return false;
+      }
+    }
+
+    m_slots[tail & m_mask] = std::move(item);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** \brief removes the first element; must be invoked by the consumer only
+   *  \retval false the ring is empty
+   */
+  bool
+  pop(T& item)
+  {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_cachedTail) {
+      m_cachedTail = m_tail.load(std::memory_order_acquire);
+      if (head == m_cachedTail) {
+        return false;
+      }
+    }
+
+    item = std::move(m_slots[head & m_mask]);
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  static size_t
+  roundUpToPowerOfTwo(size_t n)
+  {
+    size_t p = 1;
+    while (p < n) {
+      p <<= 1;
+    }
+    return p;
+  }
+
+private:
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  const size_t m_mask;
+  std::vector<T> m_slots;
+
+  // consumer state
+  char m_padding1[CACHE_LINE_SIZE];
+  std::atomic<size_t> m_head{0}; ///< index of next element to pop
+  size_t m_cachedTail = 0;
+
+  // producer state, on a separate cache line to avoid false sharing
+  char m_padding2[CACHE_LINE_SIZE];
+  std::atomic<size_t> m_tail{0}; ///< index of next slot to push
+  size_t m_cachedHead = 0;
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_SPSC_RING_HPP
@@ -0,0 +1,313 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "timing-wheel.hpp"
+
+namespace nfd {
+namespace scheduler {
+
+using detail::TimerLink;
+using detail::TimerNode;
+
+const time::milliseconds TimingWheel::RESOLUTION(1);
+constexpr uint64_t TimingWheel::MAX_DELTA;
+
+static inline uint64_t
+toTickFloor(const time::steady_clock::TimePoint& tp)
+{
+  return static_cast<uint64_t>(time::duration_cast<time::milliseconds>(tp.time_since_epoch()).count());
+}
+
+static inline uint64_t
+toTickCeil(const time::steady_clock::TimePoint& tp)
+{
+  auto ms = time::duration_cast<time::milliseconds>(tp.time_since_epoch());
+  return static_cast<uint64_t>(ms.count()) + (ms < tp.time_since_epoch() ? 1 : 0);
+}
+
+static inline time::steady_clock::TimePoint
+fromTick(uint64_t tick)
+{
+  return time::steady_clock::TimePoint(time::milliseconds(tick));
+}
+
+static inline void
+initList(TimerLink& head)
+{
+  head.prev = head.next = &head;
+}
+
+static inline bool
+isListEmpty(const TimerLink& head)
+{
+  return head.next == &head;
+}
+
+static inline void
+linkBefore(TimerLink& head, TimerLink* link)
+{
+  link->prev = head.prev;
+  link->next = &head;
+  head.prev->next = link;
+  head.prev = link;
+}
+
+static inline void
+unlink(TimerLink* link)
+{
+  link->prev->next = link->next;
+  link->next->prev = link->prev;
+  link->prev = link->next = link;
+}
+
+/** \brief move all links from \p src to the empty list \p dst
+ */
+static inline void
+spliceList(TimerLink& src, TimerLink& dst)
+{
+  BOOST_ASSERT(isListEmpty(dst));
+  if (isListEmpty(src)) {
+    return;
+  }
+  dst.next = src.next;
+  dst.prev = src.prev;
+  dst.next->prev = &dst;
+  dst.prev->next = &dst;
+  initList(src);
+}
+
+TimingWheel::TimingWheel()
+  : TimingWheel(nullptr)
+{
+}
+
+TimingWheel::TimingWheel(ContextCallback contextCallback)
+  : m_contextCallback(std::move(contextCallback))
+  , m_currentTick(toTickFloor(time::steady_clock::now()))
+  , m_nTimers(0)
+  , m_isProcessing(false)
+  , m_freeNodes(nullptr)
+  , m_armedTick(NO_TICK)
+{
+  for (auto& level : m_slots) {
+    for (TimerLink& slot : level) {
+      initList(slot);
+    }
+  }
+}
+
+TimingWheel::~TimingWheel() = default;
+
+TimerId
+TimingWheel::schedule(time::nanoseconds after, EventCallback callback)
+{
+  BOOST_ASSERT(callback != nullptr);
+  TimerNode* node = this->allocateNode();
+  node->callback = std::move(callback);
+  return this->start(node, after);
+}
+
+TimerId
+TimingWheel::schedule(time::nanoseconds after, shared_ptr<void> context)
+{
+  BOOST_ASSERT(m_contextCallback != nullptr);
+  TimerNode* node = this->allocateNode();
+  node->context = std::move(context);
+  return this->start(node, after);
+}
+
+TimerId
+TimingWheel::start(TimerNode* node, time::nanoseconds after)
+{
+  auto now = time::steady_clock::now();
+
+  if (m_nTimers == 0 && !m_isProcessing) {
+    // nothing is pending, so the wheel can skip ahead without processing idle ticks
+    m_currentTick = toTickFloor(now);
+  }
+
+  node->expiry = toTickCeil(now + std::max(after, time::nanoseconds::zero()));
+  ++m_nTimers;
+
+  uint64_t tick = this->place(node);
+  if (!m_isProcessing && tick < m_armedTick) {
+    this->arm(tick);
+  }
+  return TimerId(node, node->generation);
+}
+
+void
+TimingWheel::cancel(const TimerId& id)
+{
+  TimerNode* node = id.m_node;
+  if (node == nullptr || node->generation != id.m_generation) {
+    // timer has fired or has been canceled
+    return;
+  }
+
+  unlink(node);
+  this->releaseNode(node);
+  --m_nTimers;
+  // the driving event is left armed: an idle wakeup is cheaper than rescheduling
+}
+
+uint64_t
+TimingWheel::place(TimerNode* node)
+{
+  uint64_t expiry = std::max(node->expiry, m_currentTick);
+  // timers beyond the wheel's span are parked in the farthest slot, and re-placed on cascade
+  uint64_t delta = std::min(expiry - m_currentTick, MAX_DELTA);
+  uint64_t slotTick = m_currentTick + delta;
+
+  size_t level = 0;
+  while (level < N_LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+    ++level;
+  }
+
+  size_t slot = (slotTick >> (SLOT_BITS * level)) & SLOT_MASK;
+  linkBefore(m_slots[level][slot], node);
+
+  if (level == 0) {
+    return expiry;
+  }
+  // timer becomes due for cascading at a level-0 rollover
+  return this->getNextRollover();
+}
+
+void
+TimingWheel::cascade(size_t level)
+{
+  size_t slot = (m_currentTick >> (SLOT_BITS * level)) & SLOT_MASK;
+  TimerLink pending;
+  initList(pending);
+  spliceList(m_slots[level][slot], pending);
+
+  while (!isListEmpty(pending)) {
+    TimerNode* node = static_cast<TimerNode*>(pending.next);
+    unlink(node);
+    this->place(node);
+  }
+}
+
+void
+TimingWheel::processTicks()
+{
+  m_armedTick = NO_TICK;
+  m_isProcessing = true;
+
+  uint64_t nowTick = toTickFloor(time::steady_clock::now());
+  while (m_nTimers > 0 && m_currentTick <= nowTick) {
+    // cascade coarser levels at rollover of the finer level
+    for (size_t level = 1; level < N_LEVELS; ++level) {
+      if (((m_currentTick >> (SLOT_BITS * (level - 1))) & SLOT_MASK) != 0) {
+        break;
+      }
+      this->cascade(level);
+    }
+
+    TimerLink expired;
+    initList(expired);
+    spliceList(m_slots[0][m_currentTick & SLOT_MASK], expired);
+    // timers scheduled by callbacks below must go into a later slot
+    ++m_currentTick;
+
+    while (!isListEmpty(expired)) {
+      TimerNode* node = static_cast<TimerNode*>(expired.next);
+      unlink(node);
+      EventCallback callback = std::move(node->callback);
+      shared_ptr<void> context = std::move(node->context);
+      this->releaseNode(node);
+      --m_nTimers;
+      if (callback != nullptr) {
+        callback();
+      }
+      else {
+        m_contextCallback(context);
+      }
+    }
+  }
+
+  m_isProcessing = false;
+  if (m_nTimers > 0) {
+    this->arm(this->findNextTick());
+  }
+}
+
+uint64_t
+TimingWheel::findNextTick() const
+{
+  uint64_t rollover = this->getNextRollover();
+  if (rollover == m_currentTick) {
+    // cascading is due before level 0 can be examined
+    return rollover;
+  }
+
+  for (uint64_t tick = m_currentTick; tick < rollover; ++tick) {
+    if (!isListEmpty(m_slots[0][tick & SLOT_MASK])) {
+      return tick;
+    }
+  }
+  return rollover;
+}
+
+void
+TimingWheel::arm(uint64_t tick)
+{
+  m_armedTick = tick;
+  time::nanoseconds delay = fromTick(tick) - time::steady_clock::now();
+  m_tickEvent = scheduler::schedule(std::max(delay, time::nanoseconds::zero()),
+                                    [this] { this->processTicks(); });
+}
+
+TimerNode*
+TimingWheel::allocateNode()
+{
+  if (m_freeNodes == nullptr) {
+    m_chunks.push_back(make_unique<TimerNode[]>(N_NODES_PER_CHUNK));
+    TimerNode* chunk = m_chunks.back().get();
+    for (size_t i = 0; i < N_NODES_PER_CHUNK; ++i) {
+      chunk[i].generation = 0;
+      this->releaseNode(&chunk[i]);
+    }
+  }
+
+  TimerNode* node = m_freeNodes;
+  m_freeNodes = static_cast<TimerNode*>(node->next);
+  return node;
+}
+
+void
+TimingWheel::releaseNode(TimerNode* node)
+{
+  node->callback = nullptr;
+  node->context.reset();
+  ++node->generation;
+  node->prev = nullptr;
+  node->next = m_freeNodes;
+  m_freeNodes = node;
+}
+
+} // namespace scheduler
+} // namespace nfd
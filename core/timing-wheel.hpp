@@ -0,0 +1,216 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_TIMING_WHEEL_HPP
+#define NFD_CORE_TIMING_WHEEL_HPP
+
+#include "scheduler.hpp"
+
+#include <array>
+
+namespace nfd {
+namespace scheduler {
+
+class TimingWheel;
+
+namespace detail {
+
+/** \brief link in the circular doubly linked list of a timing wheel slot
+ */
+struct TimerLink
+{
+  TimerLink* prev;
+  TimerLink* next;
+};
+
+/** \brief a timer in a timing wheel
+ */
+struct TimerNode : public TimerLink
+{
+  uint64_t expiry; ///< tick at which the timer fires
+  uint32_t generation; ///< incremented each time the node is released
+  EventCallback callback; ///< invoked on expiry, if set
+  shared_ptr<void> context; ///< passed to the wheel's ContextCallback, if callback is not set
+};
+
+} // namespace detail
+
+/** \brief identifies a timer scheduled in a TimingWheel
+ *
+ *  A default-constructed TimerId does not refer to any timer.
+ *  Canceling a TimerId whose timer has fired or has been canceled has no effect.
+ *  \warning A TimerId must not be used after its TimingWheel is destructed.
+ */
+class TimerId
+{
+public:
+  TimerId() = default;
+
+private:
+  TimerId(detail::TimerNode* node, uint32_t generation)
+    : m_node(node)
+    , m_generation(generation)
+  {
+  }
+
+private:
+  detail::TimerNode* m_node = nullptr;
+  uint32_t m_generation = 0;
+
+  friend class TimingWheel;
+};
+
+/** \brief hierarchical timing wheel with millisecond resolution
+ *
+ *  TimingWheel is an alternative to the global scheduler for high-churn timers,
+ *  such as PIT entry expiry timers that are rescheduled several times per packet.
+ *  Scheduling and canceling a timer are O(1). Timer nodes are recycled through a free list,
+ *  and cancellation unlinks the node from its slot.
+ *
+ *  A timer scheduled with a context does not allocate memory after warm-up: the context
+ *  is kept in the timer node, and the wheel invokes one ContextCallback for all such timers.
+ *  A timer scheduled with an EventCallback allocates whenever std::function cannot store
+ *  the callback inline, which is the case for any lambda that captures a shared_ptr.
+ *
+ *  The wheel has four levels of 256 slots each. Level 0 slots are 1ms apart;
+ *  timers further in the future are kept in coarser levels and cascaded down as time
+ *  advances. A single event on the global scheduler drives the wheel, armed only for
+ *  ticks that have timers or need cascading.
+ *
+ *  \note Timers fire no earlier than requested, and at most one RESOLUTION later.
+ */
+class TimingWheel : noncopyable
+{
+public:
+  /** \brief callback invoked when a timer scheduled with a context expires
+   */
+  using ContextCallback = std::function<void(const shared_ptr<void>& context)>;
+
+  TimingWheel();
+
+  explicit
+  TimingWheel(ContextCallback contextCallback);
+
+  ~TimingWheel();
+
+  /** \brief schedule \p callback to be invoked after \p after
+   */
+  TimerId
+  schedule(time::nanoseconds after, EventCallback callback);
+
+  /** \brief schedule the ContextCallback to be invoked with \p context after \p after
+   *  \pre the wheel is constructed with a ContextCallback
+   */
+  TimerId
+  schedule(time::nanoseconds after, shared_ptr<void> context);
+
+  /** \brief cancel a timer
+   */
+  void
+  cancel(const TimerId& id);
+
+  /** \return number of pending timers
+   */
+  size_t
+  size() const
+  {
+    return m_nTimers;
+  }
+
+public:
+  static const time::milliseconds RESOLUTION;
+
+private:
+  /** \brief start the timer of \p node, whose callback or context is set
+   */
+  TimerId
+  start(detail::TimerNode* node, time::nanoseconds after);
+
+  /** \brief link \p node into the slot for its expiry
+   *  \return tick at which the wheel must be processed to handle \p node
+   */
+  uint64_t
+  place(detail::TimerNode* node);
+
+  /** \brief move timers in \p level at the current tick into lower levels
+   */
+  void
+  cascade(size_t level);
+
+  /** \brief process all ticks up to now, and fire expired timers
+   */
+  void
+  processTicks();
+
+  /** \return the earliest tick, not before the current tick, at which level 0 rolls over
+   */
+  uint64_t
+  getNextRollover() const
+  {
+    return (m_currentTick + SLOT_MASK) & ~SLOT_MASK;
+  }
+
+  /** \return the earliest tick at which the wheel must be processed
+   */
+  uint64_t
+  findNextTick() const;
+
+  /** \brief arm the driving event on the global scheduler for \p tick
+   */
+  void
+  arm(uint64_t tick);
+
+  detail::TimerNode*
+  allocateNode();
+
+  void
+  releaseNode(detail::TimerNode* node);
+
+private:
+  static constexpr size_t N_LEVELS = 4;
+  static constexpr size_t SLOT_BITS = 8;
+  static constexpr size_t N_SLOTS = 1 << SLOT_BITS;
+  static constexpr uint64_t SLOT_MASK = N_SLOTS - 1;
+  static constexpr uint64_t MAX_DELTA = (uint64_t(1) << (SLOT_BITS * N_LEVELS)) - 1;
+  static constexpr size_t N_NODES_PER_CHUNK = 256;
+  static constexpr uint64_t NO_TICK = std::numeric_limits<uint64_t>::max();
+
+  ContextCallback m_contextCallback;
+  std::array<std::array<detail::TimerLink, N_SLOTS>, N_LEVELS> m_slots;
+  uint64_t m_currentTick; ///< earliest tick that has not been processed
+  size_t m_nTimers;
+  bool m_isProcessing;
+
+  std::vector<unique_ptr<detail::TimerNode[]>> m_chunks;
+  detail::TimerNode* m_freeNodes; ///< free list, linked through TimerLink::next
+
+  uint64_t m_armedTick; ///< tick for which m_tickEvent is armed, or NO_TICK
+  ScopedEventId m_tickEvent;
+};
+
+} // namespace scheduler
+} // namespace nfd
+
+#endif // NFD_CORE_TIMING_WHEEL_HPP
@@ -89,6 +89,14 @@ protected:
   static EndpointId
   makeEndpointId(const typename protocol::endpoint& ep);
 
+  /** \brief maximum number of datagrams read in one burst
+   *
+   *  After a datagram arrives, handleReceive reads up to MAX_RECEIVE_BURST - 1 more datagrams
+   *  that are already queued in the socket, without returning to the io_service, and
+   *  delivers them as one burst.
+   */
+  static constexpr size_t MAX_RECEIVE_BURST = 32;
+
 protected:
   typename protocol::socket m_socket;
   typename protocol::endpoint m_sender;
@@ -202,8 +210,26 @@ template<class T, class U>
 void
 DatagramTransport<T, U>::handleReceive(const boost::system::error_code& error, size_t nBytesReceived)
 {
+  this->beginReceiveBurst();
   receiveDatagram(m_receiveBuffer.data(), nBytesReceived, error);
 
+  // drain datagrams that are already queued, so that they are processed as one burst
+  for (size_t i = 1; i < MAX_RECEIVE_BURST && !error && m_socket.is_open(); ++i) {
+    boost::system::error_code readError;
+    if (m_socket.available(readError) == 0 || readError) {
+      break;
+    }
+    nBytesReceived = m_socket.receive_from(boost::asio::buffer(m_receiveBuffer), m_sender, 0, readError);
+    if (readError == boost::asio::error::would_block) {
+      break;
+    }
+    receiveDatagram(m_receiveBuffer.data(), nBytesReceived, readError);
+    if (readError) {
+      break;
+    }
+  }
+  this->endReceiveBurst();
+
   if (m_socket.is_open())
     m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
                                 [this] (auto&&... args) {
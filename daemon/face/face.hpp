@@ -29,8 +29,11 @@
 #include "face-counters.hpp"
 #include "face-log.hpp"
 #include "link-service.hpp"
+#include "table-references.hpp"
 #include "transport.hpp"
 
+#include <ndn-cxx/lp/tags.hpp>
+
 namespace nfd {
 namespace face {
 
@@ -107,6 +110,11 @@ public: // upper interface connected to forwarding
    */
   signal::Signal<LinkService, lp::Nack>& afterReceiveNack;
 
+  /** \brief signals on a batch of Interests and Data received
+   *  \sa LinkService::afterReceiveBatch
+   */
+  signal::Signal<LinkService, ReceiveBatch>& afterReceiveBatch;
+
   /** \brief signals on Interest dropped by reliability system for exceeding allowed number of retx
    */
   signal::Signal<LinkService, Interest>& onDroppedInterest;
@@ -123,6 +131,13 @@ public: // static properties
   void
   setId(FaceId id);
 
+  /** \return IncomingFaceIdTag carrying face ID
+   *  \note The tag is shared by all packets received on this face, so that it is not
+   *        allocated for each packet.
+   */
+  const shared_ptr<lp::IncomingFaceIdTag>&
+  getIncomingFaceIdTag() const;
+
   void
   setMetric(uint64_t metric);
 
@@ -191,12 +206,24 @@ public: // dynamic properties
   const FaceCounters&
   getCounters() const;
 
+public: // forwarding tables
+  /** \return FIB entries and PIT records that reference this face
+   *  \note This is maintained by forwarding tables, and is not part of face state.
+   */
+  TableReferences&
+  getTableReferences() const
+  {
+    return m_tableReferences;
+  }
+
 private:
   FaceId m_id;
+  shared_ptr<lp::IncomingFaceIdTag> m_incomingFaceIdTag;
   unique_ptr<LinkService> m_service;
   unique_ptr<Transport> m_transport;
   FaceCounters m_counters;
   uint64_t m_metric;
+  mutable TableReferences m_tableReferences;
 };
 
 inline LinkService*
@@ -239,6 +266,13 @@ inline void
 Face::setId(FaceId id)
 {
   m_id = id;
+  m_incomingFaceIdTag = make_shared<lp::IncomingFaceIdTag>(id);
+}
+
+inline const shared_ptr<lp::IncomingFaceIdTag>&
+Face::getIncomingFaceIdTag() const
+{
+  return m_incomingFaceIdTag;
 }
 
 inline void
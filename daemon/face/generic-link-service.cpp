@@ -24,6 +24,7 @@
  */
 
 #include "generic-link-service.hpp"
+#include "lp-tags.hpp"
 
 #include <ndn-cxx/lp/tags.hpp>
 
@@ -354,7 +355,7 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
 
   // Increment HopCount
   if (firstPkt.has<lp::HopCountTagField>()) {
-    interest->setTag(make_shared<lp::HopCountTag>(firstPkt.get<lp::HopCountTagField>() + 1));
+    interest->setTag(makeHopCountTag(firstPkt.get<lp::HopCountTagField>() + 1));
   }
 
   if (firstPkt.has<lp::NextHopFaceIdField>()) {
@@ -378,7 +379,7 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
   }
 
   if (firstPkt.has<lp::CongestionMarkField>()) {
-    interest->setTag(make_shared<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
+    interest->setTag(makeCongestionMarkTag(firstPkt.get<lp::CongestionMarkField>()));
   }
 
   if (firstPkt.has<lp::NonDiscoveryField>()) {
@@ -408,7 +409,7 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt)
   auto data = make_shared<Data>(netPkt);
 
   if (firstPkt.has<lp::HopCountTagField>()) {
-    data->setTag(make_shared<lp::HopCountTag>(firstPkt.get<lp::HopCountTagField>() + 1));
+    data->setTag(makeHopCountTag(firstPkt.get<lp::HopCountTagField>() + 1));
   }
 
   if (firstPkt.has<lp::NackField>()) {
@@ -435,7 +436,7 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt)
   }
 
   if (firstPkt.has<lp::CongestionMarkField>()) {
-    data->setTag(make_shared<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
+    data->setTag(makeCongestionMarkTag(firstPkt.get<lp::CongestionMarkField>()));
   }
 
   if (firstPkt.has<lp::NonDiscoveryField>()) {
@@ -482,7 +483,7 @@ GenericLinkService::decodeNack(const Block& netPkt, const lp::Packet& firstPkt)
   }
 
   if (firstPkt.has<lp::CongestionMarkField>()) {
-    nack.setTag(make_shared<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
+    nack.setTag(makeCongestionMarkTag(firstPkt.get<lp::CongestionMarkField>()));
   }
 
   if (firstPkt.has<lp::NonDiscoveryField>()) {
@@ -31,9 +31,12 @@ namespace face {
 
 NFD_LOG_INIT(LinkService);
 
+constexpr size_t LinkService::MAX_RECEIVE_BATCH;
+
 LinkService::LinkService()
   : m_face(nullptr)
   , m_transport(nullptr)
+  , m_isReceivingBatch(false)
 {
 }
 
@@ -97,6 +100,14 @@ LinkService::receiveInterest(const Interest& interest)
 
   ++this->nInInterests;
 
+  if (this->shouldBatch()) {
+    m_receiveBatch.push_back({interest.shared_from_this(), nullptr});
+    if (m_receiveBatch.size() >= MAX_RECEIVE_BATCH) {
+      this->flushReceiveBatch();
+    }
+    return;
+  }
+
   afterReceiveInterest(interest);
 }
 
@@ -107,6 +118,14 @@ LinkService::receiveData(const Data& data)
 
   ++this->nInData;
 
+  if (this->shouldBatch()) {
+    m_receiveBatch.push_back({nullptr, data.shared_from_this()});
+    if (m_receiveBatch.size() >= MAX_RECEIVE_BATCH) {
+      this->flushReceiveBatch();
+    }
+    return;
+  }
+
   afterReceiveData(data);
 }
 
@@ -117,9 +136,36 @@ LinkService::receiveNack(const ndn::lp::Nack& nack)
 
   ++this->nInNacks;
 
+  // preserve arrival order with respect to batched Interests and Data
+  this->flushReceiveBatch();
+
   afterReceiveNack(nack);
 }
 
+void
+LinkService::beginReceiveBatch()
+{
+  m_isReceivingBatch = true;
+}
+
+void
+LinkService::endReceiveBatch()
+{
+  this->flushReceiveBatch();
+  m_isReceivingBatch = false;
+}
+
+void
+LinkService::flushReceiveBatch()
+{
+  if (m_receiveBatch.empty()) {
+    return;
+  }
+
+  afterReceiveBatch(m_receiveBatch);
+  m_receiveBatch.clear(); // keeps the capacity for the next batch
+}
+
 void
 LinkService::notifyDroppedInterest(const Interest& interest)
 {
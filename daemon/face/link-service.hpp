@@ -71,6 +71,21 @@ public:
   PacketCounter nOutNacks;
 };
 
+/** \brief a network-layer packet in a ReceiveBatch
+ *
+ *  Exactly one of \p interest and \p data is set.
+ */
+struct ReceivedPacket
+{
+  shared_ptr<const Interest> interest;
+  shared_ptr<const Data> data;
+};
+
+/** \brief network-layer packets received in a burst, in arrival order
+ *  \sa LinkService::afterReceiveBatch
+ */
+using ReceiveBatch = std::vector<ReceivedPacket>;
+
 /** \brief the upper part of a Face
  *  \sa Face
  */
@@ -142,6 +157,20 @@ public: // upper interface to be used by forwarding
    */
   signal::Signal<LinkService, lp::Nack> afterReceiveNack;
 
+  /** \brief signals on a batch of Interests and Data received
+   *
+   *  If this signal has a handler, Interests and Data received between beginReceiveBatch
+   *  and endReceiveBatch are delivered through this signal in batches of at most
+   *  MAX_RECEIVE_BATCH packets, instead of through afterReceiveInterest and afterReceiveData.
+   *  A Nack is still delivered through afterReceiveNack, after the Interests and Data
+   *  received before it.
+   */
+  signal::Signal<LinkService, ReceiveBatch> afterReceiveBatch;
+
+  /** \brief maximum number of packets in a ReceiveBatch
+   */
+  static constexpr size_t MAX_RECEIVE_BATCH = 32;
+
   /** \brief signals on Interest dropped by reliability system for exceeding allowed number of retx
    */
   signal::Signal<LinkService, Interest> onDroppedInterest;
@@ -164,6 +193,16 @@ public: // lower interface to be invoked by Transport
   void
   receivePacket(Transport::Packet&& packet);
 
+  /** \brief starts collecting received Interests and Data into a batch
+   */
+  void
+  beginReceiveBatch();
+
+  /** \brief delivers collected Interests and Data, and stops collecting
+   */
+  void
+  endReceiveBatch();
+
 protected: // upper interface to be invoked in subclass (receive path termination)
   /** \brief delivers received Interest to forwarding
    */
@@ -210,9 +249,21 @@ private: // lower interface to be overridden in subclass
   virtual void
   doReceivePacket(Transport::Packet&& packet) = 0;
 
+private:
+  bool
+  shouldBatch() const
+  {
+    return m_isReceivingBatch && !afterReceiveBatch.isEmpty();
+  }
+
+  void
+  flushReceiveBatch();
+
 private:
   Face* m_face;
   Transport* m_transport;
+  bool m_isReceivingBatch;
+  ReceiveBatch m_receiveBatch;
 };
 
 inline const Face*
@@ -0,0 +1,64 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "lp-tags.hpp"
+
+#include <array>
+
+namespace nfd {
+namespace face {
+
+template<typename Tag>
+static shared_ptr<Tag>
+makeSharedTag(uint64_t value)
+{
+  static const auto sharedTags = [] {
+    std::array<shared_ptr<Tag>, N_SHARED_TAG_VALUES> tags;
+    for (size_t i = 0; i < tags.size(); ++i) {
+      tags[i] = make_shared<Tag>(i);
+    }
+    return tags;
+  }();
+
+  if (value < sharedTags.size()) {
+    return sharedTags[value];
+  }
+  return make_shared<Tag>(value);
+}
+
+shared_ptr<lp::HopCountTag>
+makeHopCountTag(uint64_t hopCount)
+{
+  return makeSharedTag<lp::HopCountTag>(hopCount);
+}
+
+shared_ptr<lp::CongestionMarkTag>
+makeCongestionMarkTag(uint64_t congestionMark)
+{
+  return makeSharedTag<lp::CongestionMarkTag>(congestionMark);
+}
+
+} // namespace face
+} // namespace nfd
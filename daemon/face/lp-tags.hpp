@@ -0,0 +1,56 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_LP_TAGS_HPP
+#define NFD_DAEMON_FACE_LP_TAGS_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+namespace nfd {
+namespace face {
+
+/** \brief number of small values for which packet tags are preallocated and shared
+ *
+ *  A packet tag is immutable once created, so the same tag can be attached to many packets.
+ *  Sharing tags of common values saves an allocation for each packet that carries them.
+ */
+const uint64_t N_SHARED_TAG_VALUES = 256;
+
+/** \return a HopCountTag with \p hopCount, shared with other packets if the value is small
+ */
+shared_ptr<lp::HopCountTag>
+makeHopCountTag(uint64_t hopCount);
+
+/** \return a CongestionMarkTag with \p congestionMark, shared with other packets if the value is small
+ */
+shared_ptr<lp::CongestionMarkTag>
+makeCongestionMarkTag(uint64_t congestionMark);
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_LP_TAGS_HPP
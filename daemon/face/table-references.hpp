@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_TABLE_REFERENCES_HPP
+#define NFD_DAEMON_FACE_TABLE_REFERENCES_HPP
+
+#include "core/common.hpp"
+
+#include <boost/intrusive/list.hpp>
+
+namespace nfd {
+
+namespace fib {
+class Entry;
+} // namespace fib
+
+namespace pit {
+class Entry;
+} // namespace pit
+
+namespace face {
+
+class Face;
+
+/** \brief hook of an intrusive list of table references,
+ *         which unlinks itself when the referencing record is destructed
+ */
+using TableReferenceHook = boost::intrusive::list_base_hook<
+                             boost::intrusive::link_mode<boost::intrusive::auto_unlink>>;
+
+/** \brief a reference from a FIB entry with one or more nexthops toward a face
+ */
+class FibReference : public TableReferenceHook
+{
+public:
+  FibReference(fib::Entry& entry, const Face& face)
+    : m_entry(&entry)
+    , m_face(&face)
+  {
+  }
+
+  fib::Entry&
+  getEntry() const
+  {
+    return *m_entry;
+  }
+
+  const Face&
+  getFace() const
+  {
+    return *m_face;
+  }
+
+private:
+  fib::Entry* m_entry;
+  const Face* m_face;
+};
+
+/** \brief a reference from a PIT in-record or out-record toward a face
+ */
+class PitReference : public TableReferenceHook
+{
+public:
+  explicit
+  PitReference(pit::Entry* entry = nullptr)
+    : m_entry(entry)
+  {
+  }
+
+  /** \return PIT entry containing the record, or nullptr if the record is not linked
+   */
+  pit::Entry*
+  getEntry() const
+  {
+    return m_entry;
+  }
+
+private:
+  pit::Entry* m_entry;
+};
+
+/** \brief table records that reference a face
+ *
+ *  FIB entries and PIT face records link themselves into these lists when they
+ *  start referencing a face, and are unlinked automatically when they are destructed.
+ *  This allows cleanup after face removal to visit only the affected table entries.
+ */
+class TableReferences : noncopyable
+{
+public:
+  using FibReferenceList = boost::intrusive::list<FibReference,
+                                                  boost::intrusive::constant_time_size<false>>;
+  using PitReferenceList = boost::intrusive::list<PitReference,
+                                                  boost::intrusive::constant_time_size<false>>;
+
+  FibReferenceList fib;
+  PitReferenceList pit;
+
+  /** \brief generation of the last multi-match Data that selected this face as a downstream
+   *
+   *  Forwarder compares this with its own generation counter to send such a Data
+   *  at most once per face, without building a set of downstream faces.
+   */
+  uint64_t downstreamGeneration = 0;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_TABLE_REFERENCES_HPP
@@ -128,6 +128,18 @@ Transport::receive(Packet&& packet)
   m_service->receivePacket(std::move(packet));
 }
 
+void
+Transport::beginReceiveBurst()
+{
+  m_service->beginReceiveBatch();
+}
+
+void
+Transport::endReceiveBurst()
+{
+  m_service->endReceiveBatch();
+}
+
 bool
 Transport::canChangePersistencyTo(ndn::nfd::FacePersistency newPersistency) const
 {
@@ -296,6 +296,20 @@ protected: // upper interface to be invoked by subclass
   void
   receive(Packet&& packet);
 
+  /** \brief mark the start of a burst of link-layer packets
+   *
+   *  Interests and Data decoded from packets received until endReceiveBurst
+   *  are delivered to forwarding in batches.
+   *  \sa LinkService::afterReceiveBatch
+   */
+  void
+  beginReceiveBurst();
+
+  /** \brief mark the end of a burst of link-layer packets
+   */
+  void
+  endReceiveBurst();
+
 protected: // properties to be set by subclass
   void
   setLocalUri(const FaceUri& uri);
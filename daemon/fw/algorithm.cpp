@@ -78,6 +78,9 @@ int
 findDuplicateNonce(const pit::Entry& pitEntry, uint32_t nonce, const Face& face)
 {
   int dnw = DUPLICATE_NONCE_NONE;
+  if (!pitEntry.mayHaveNonce(nonce)) {
+    return dnw;
+  }
 
   for (const pit::InRecord& inRecord : pitEntry.getInRecords()) {
     if (inRecord.getLastNonce() == nonce) {
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FW_FORWARDER_COUNTERS_HPP
 
 #include "core/counter.hpp"
+#include "core/latency-histogram.hpp"
 
 namespace nfd {
 
@@ -46,6 +47,23 @@ public:
 
   PacketCounter nCsHits;
   PacketCounter nCsMisses;
+
+  SimpleCounter nCleanedFibEntries; ///< FIB entries that lost a nexthop to a removed face
+  SimpleCounter nCleanedPitEntries; ///< PIT entries that lost records to a removed face
+
+  /** \name per-stage processing latency
+   *
+   *  Each stage is timed from entry to exit, so that a stage's latency includes
+   *  the stages it invokes, e.g. incoming Interest includes CS lookup.
+   */
+  ///@{
+  LatencyHistogram inInterestLatency; ///< incoming Interest pipeline
+  LatencyHistogram csLookupLatency; ///< Content Store lookup, until the hit or miss decision
+  LatencyHistogram strategyLatency; ///< strategy afterReceiveInterest trigger
+  LatencyHistogram outInterestLatency; ///< outgoing Interest pipeline
+  LatencyHistogram inDataLatency; ///< incoming Data pipeline
+  LatencyHistogram pitMatchLatency; ///< PIT lookup for incoming Data
+  ///@}
 };
 
 } // namespace nfd
@@ -52,6 +52,9 @@ Forwarder::Forwarder()
   , m_measurements(m_nameTree)
   , m_strategyChoice(*this)
   , m_csFace(face::makeNullFace(FaceUri("contentstore://")))
+  , m_pitExpiryTimers([this] (const shared_ptr<void>& context) {
+      this->onInterestFinalize(static_pointer_cast<pit::Entry>(context));
+    })
 {
   getFaceTable().addReserved(m_csFace, face::FACEID_CONTENT_STORE);
 
@@ -68,6 +71,10 @@ Forwarder::Forwarder()
       [this, &face] (const lp::Nack& nack) {
         this->startProcessNack(face, nack);
       });
+    face.afterReceiveBatch.connect(
+      [this, &face] (const face::ReceiveBatch& batch) {
+        this->startProcessBatch(face, batch);
+      });
     face.onDroppedInterest.connect(
       [this, &face] (const Interest& interest) {
         this->onDroppedInterest(face, interest);
@@ -75,7 +82,9 @@ Forwarder::Forwarder()
   });
 
   m_faceTable.beforeRemove.connect([this] (Face& face) {
-    cleanupOnFaceRemoval(m_nameTree, m_fib, m_pit, face);
+    CleanupResult cleaned = cleanupOnFaceRemoval(m_nameTree, m_fib, m_pit, face);
+    m_counters.nCleanedFibEntries.set(m_counters.nCleanedFibEntries + cleaned.nFibEntries);
+    m_counters.nCleanedPitEntries.set(m_counters.nCleanedPitEntries + cleaned.nPitEntries);
   });
 
   m_strategyChoice.setDefaultStrategy(getDefaultStrategyName());
@@ -86,10 +95,12 @@ Forwarder::~Forwarder() = default;
 void
 Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
 {
+  ScopedLatencySample latencySample(m_counters.inInterestLatency);
+
   // receive Interest
   NFD_LOG_DEBUG("onIncomingInterest face=" << inFace.getId() <<
                 " interest=" << interest.getName());
-  interest.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
+  interest.setTag(inFace.getIncomingFaceIdTag());
   ++m_counters.nInInterests;
 
   // /localhost scope control
@@ -134,12 +145,19 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
     return;
   }
 
+  // is Content Store lookup pending?
+  if (pitEntry->pendingCsLookup != 0) {
+    NFD_LOG_DEBUG("onIncomingInterest face=" << inFace.getId() <<
+                  " interest=" << interest.getName() << " aggregate-cs-lookup");
+    pitEntry->insertOrUpdateInRecord(inFace, interest);
+    this->setExpiryTimerToLastInRecord(pitEntry);
+    return;
+  }
+
   // is pending?
   if (!pitEntry->hasInRecords()) {
     if (m_csFromNdnSim == nullptr) {
-      m_cs.find(interest,
-                bind(&Forwarder::onContentStoreHit, this, std::ref(inFace), pitEntry, _1, _2),
-                bind(&Forwarder::onContentStoreMiss, this, std::ref(inFace), pitEntry, _1));
+      this->lookupContentStore(inFace, pitEntry, interest);
     }
     else {
       shared_ptr<Data> match = m_csFromNdnSim->Lookup(interest.shared_from_this());
@@ -156,6 +174,39 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
   }
 }
 
+void
+Forwarder::startProcessBatch(Face& face, const face::ReceiveBatch& batch)
+{
+  BOOST_ASSERT(batch.size() <= face::LinkService::MAX_RECEIVE_BATCH);
+
+  // Both pipelines start with a name tree lookup of the packet name: PIT insert for an Interest,
+  // PIT match for a Data. Hashing every name and prefetching in two passes lets the cache misses
+  // of the whole batch overlap, instead of stalling each pipeline in turn.
+  std::array<name_tree::HashValue, face::LinkService::MAX_RECEIVE_BATCH> hashes;
+  for (size_t i = 0; i < batch.size(); ++i) {
+    const Name& name = batch[i].interest != nullptr ? batch[i].interest->getName() :
+                                                      batch[i].data->getName();
+    // same depth as Pit::findOrInsert and NameTree::findLongestPrefixMatch
+    bool hasDigest = batch[i].interest != nullptr && name.size() > 0 &&
+                     name[-1].isImplicitSha256Digest();
+    size_t depth = std::min(name.size() - static_cast<int>(hasDigest), NameTree::getMaxDepth());
+    hashes[i] = name_tree::computeHash(name, depth);
+    m_nameTree.prefetchBucket(hashes[i]);
+  }
+  for (size_t i = 0; i < batch.size(); ++i) {
+    m_nameTree.prefetchNode(hashes[i]);
+  }
+
+  for (const face::ReceivedPacket& packet : batch) {
+    if (packet.interest != nullptr) {
+      this->startProcessInterest(face, *packet.interest);
+    }
+    else {
+      this->startProcessData(face, *packet.data);
+    }
+  }
+}
+
 void
 Forwarder::onInterestLoop(Face& inFace, const Interest& interest)
 {
@@ -195,9 +246,7 @@ Forwarder::onContentStoreMiss(const Face& inFace, const shared_ptr<pit::Entry>&
   pitEntry->insertOrUpdateInRecord(const_cast<Face&>(inFace), interest);
 
   // set PIT expiry timer to the time that the last PIT in-record expires
-  auto lastExpiring = std::max_element(pitEntry->in_begin(), pitEntry->in_end(), &compare_InRecord_expiry);
-  auto lastExpiryFromNow = lastExpiring->getExpiry() - time::steady_clock::now();
-  this->setExpiryTimer(pitEntry, time::duration_cast<time::milliseconds>(lastExpiryFromNow));
+  this->setExpiryTimerToLastInRecord(pitEntry);
 
   // has NextHopFaceId?
   shared_ptr<lp::NextHopFaceIdTag> nextHopTag = interest.getTag<lp::NextHopFaceIdTag>();
@@ -214,6 +263,7 @@ Forwarder::onContentStoreMiss(const Face& inFace, const shared_ptr<pit::Entry>&
   }
 
   // dispatch to strategy: after incoming Interest
+  ScopedLatencySample latencySample(m_counters.strategyLatency);
   this->dispatchToStrategy(*pitEntry,
     [&] (fw::Strategy& strategy) { strategy.afterReceiveInterest(inFace, interest, pitEntry); });
 }
@@ -225,7 +275,8 @@ Forwarder::onContentStoreHit(const Face& inFace, const shared_ptr<pit::Entry>& p
   NFD_LOG_DEBUG("onContentStoreHit interest=" << interest.getName());
   ++m_counters.nCsHits;
 
-  data.setTag(make_shared<lp::IncomingFaceIdTag>(face::FACEID_CONTENT_STORE));
+  data.setTag(m_csFace->getIncomingFaceIdTag());
+  data.removeTag<lp::HopCountTag>();
   // XXX should we lookup PIT for other Interests that also match csMatch?
 
   pitEntry->isSatisfied = true;
@@ -243,9 +294,122 @@ Forwarder::onContentStoreHit(const Face& inFace, const shared_ptr<pit::Entry>& p
     [&] (fw::Strategy& strategy) { strategy.afterContentStoreHit(pitEntry, inFace, data); });
 }
 
+void
+Forwarder::lookupContentStore(Face& inFace, const shared_ptr<pit::Entry>& pitEntry,
+                              const Interest& interest)
+{
+  // callbacks invoked after find() returns must not use inFace, which may have been destroyed
+  auto isDeferred = make_shared<bool>(false);
+  FaceId inFaceId = inFace.getId();
+  uint64_t lookupId = ++m_lastCsLookupId;
+
+  pitEntry->pendingCsLookup = lookupId;
+  // a synchronous decision stops the sample before the hit or miss pipeline starts;
+  // a deferred lookup is sampled until find() returns
+  ScopedLatencySample latencySample(m_counters.csLookupLatency);
+  m_cs.find(interest,
+    [this, &inFace, pitEntry, isDeferred, lookupId, &latencySample] (const Interest& interest,
+                                                                     const Data& data) {
+      if (pitEntry->pendingCsLookup != lookupId) {
+        return;
+      }
+      pitEntry->pendingCsLookup = 0;
+      if (*isDeferred) {
+        this->onDeferredContentStoreHit(pitEntry, data);
+      }
+      else {
+        latencySample.stop();
+        this->onContentStoreHit(inFace, pitEntry, interest, data);
+      }
+    },
+    [this, &inFace, pitEntry, isDeferred, lookupId, inFaceId, &latencySample] (const Interest& interest) {
+      if (pitEntry->pendingCsLookup != lookupId) {
+        return;
+      }
+      pitEntry->pendingCsLookup = 0;
+      if (*isDeferred) {
+        this->onDeferredContentStoreMiss(inFaceId, pitEntry);
+      }
+      else {
+        latencySample.stop();
+        this->onContentStoreMiss(inFace, pitEntry, interest);
+      }
+    });
+  latencySample.stop();
+
+  if (pitEntry->pendingCsLookup == lookupId) {
+    NFD_LOG_DEBUG("lookupContentStore interest=" << interest.getName() << " deferred");
+    *isDeferred = true;
+    // hold the PIT entry until the decision arrives or the Interest expires
+    pitEntry->insertOrUpdateInRecord(inFace, interest);
+    this->setExpiryTimerToLastInRecord(pitEntry);
+  }
+}
+
+void
+Forwarder::onDeferredContentStoreHit(const shared_ptr<pit::Entry>& pitEntry, const Data& data)
+{
+  // the entry may have expired, or been satisfied by incoming Data, while the lookup was pending
+  if (!pitEntry->isInTable() || !pitEntry->hasInRecords()) {
+    NFD_LOG_DEBUG("onDeferredContentStoreHit interest=" << pitEntry->getName() << " entry-gone");
+    return;
+  }
+
+  NFD_LOG_DEBUG("onDeferredContentStoreHit interest=" << pitEntry->getName());
+  ++m_counters.nCsHits;
+
+  data.setTag(m_csFace->getIncomingFaceIdTag());
+  data.removeTag<lp::HopCountTag>();
+
+  pitEntry->isSatisfied = true;
+  pitEntry->dataFreshnessPeriod = data.getFreshnessPeriod();
+
+  // set PIT expiry timer to now
+  this->setExpiryTimer(pitEntry, 0_ms);
+
+  beforeSatisfyInterest(*pitEntry, *m_csFace, data);
+  this->dispatchToStrategy(*pitEntry,
+    [&] (fw::Strategy& strategy) { strategy.beforeSatisfyInterest(pitEntry, *m_csFace, data); });
+
+  // dispatch to strategy: after Content Store hit, for each aggregated downstream;
+  // the strategy deletes in-records while sending Data, so downstreams are collected first
+  std::vector<const Face*> downstreams;
+  for (const pit::InRecord& inRecord : pitEntry->getInRecords()) {
+    downstreams.push_back(&inRecord.getFace());
+  }
+  for (const Face* downstream : downstreams) {
+    this->dispatchToStrategy(*pitEntry,
+      [&] (fw::Strategy& strategy) { strategy.afterContentStoreHit(pitEntry, *downstream, data); });
+  }
+}
+
+void
+Forwarder::onDeferredContentStoreMiss(FaceId inFaceId, const shared_ptr<pit::Entry>& pitEntry)
+{
+  // the entry may have expired, or been satisfied by incoming Data, while the lookup was pending
+  if (!pitEntry->isInTable() || !pitEntry->hasInRecords()) {
+    NFD_LOG_DEBUG("onDeferredContentStoreMiss interest=" << pitEntry->getName() << " entry-gone");
+    return;
+  }
+
+  // continue on behalf of the downstream that started the lookup,
+  // or an aggregated downstream if that one has gone
+  auto inRecord = std::find_if(pitEntry->in_begin(), pitEntry->in_end(),
+    [inFaceId] (const pit::InRecord& inRecord) { return inRecord.getFace().getId() == inFaceId; });
+  if (inRecord == pitEntry->in_end()) {
+    inRecord = pitEntry->in_begin();
+  }
+
+  // hold the Interest, because onContentStoreMiss updates the in-record
+  shared_ptr<const Interest> interest = inRecord->getInterest().shared_from_this();
+  this->onContentStoreMiss(inRecord->getFace(), pitEntry, *interest);
+}
+
 void
 Forwarder::onOutgoingInterest(const shared_ptr<pit::Entry>& pitEntry, Face& outFace, const Interest& interest)
 {
+  ScopedLatencySample latencySample(m_counters.outInterestLatency);
+
   NFD_LOG_DEBUG("onOutgoingInterest face=" << outFace.getId() <<
                 " interest=" << pitEntry->getName());
 
@@ -276,17 +440,20 @@ Forwarder::onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry)
     ++m_counters.nUnsatisfiedInterests;
   }
 
-  // PIT delete
-  scheduler::cancel(pitEntry->expiryTimer);
+  // PIT delete; a late lookup decision is ignored
+  pitEntry->pendingCsLookup = 0;
+  m_pitExpiryTimers.cancel(pitEntry->expiryTimer);
   m_pit.erase(pitEntry.get());
 }
 
 void
 Forwarder::onIncomingData(Face& inFace, const Data& data)
 {
+  ScopedLatencySample latencySample(m_counters.inDataLatency);
+
   // receive Data
   NFD_LOG_DEBUG("onIncomingData face=" << inFace.getId() << " data=" << data.getName());
-  data.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
+  data.setTag(inFace.getIncomingFaceIdTag());
   ++m_counters.nInData;
 
   // /localhost scope control
@@ -300,21 +467,23 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
   }
 
   // PIT match
+  ScopedLatencySample pitMatchSample(m_counters.pitMatchLatency);
   pit::DataMatchResult pitMatches = m_pit.findAllDataMatches(data);
+  pitMatchSample.stop();
   if (pitMatches.size() == 0) {
     // goto Data unsolicited pipeline
     this->onDataUnsolicited(inFace, data);
     return;
   }
 
-  shared_ptr<Data> dataCopyWithoutTag = make_shared<Data>(data);
-  dataCopyWithoutTag->removeTag<lp::HopCountTag>();
-
   // CS insert
+  // The CS shares this Data packet instead of a copy. Link-layer tags such as HopCountTag
+  // are left in place, because the Data is still being forwarded; they are reset when the
+  // cached Data is served in onContentStoreHit.
   if (m_csFromNdnSim == nullptr)
-    m_cs.insert(*dataCopyWithoutTag);
+    m_cs.insert(data);
   else
-    m_csFromNdnSim->Add(dataCopyWithoutTag);
+    m_csFromNdnSim->Add(data.shared_from_this());
 
   // when only one PIT entry is matched, trigger strategy: after receive Data
   if (pitMatches.size() == 1) {
@@ -330,9 +499,10 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
     this->dispatchToStrategy(*pitEntry,
       [&] (fw::Strategy& strategy) { strategy.afterReceiveData(pitEntry, inFace, data); });
 
-    // mark PIT satisfied
+    // mark PIT satisfied; a pending lookup can no longer serve it
     pitEntry->isSatisfied = true;
     pitEntry->dataFreshnessPeriod = data.getFreshnessPeriod();
+    pitEntry->pendingCsLookup = 0;
 
     // Dead Nonce List insert if necessary (for out-record of inFace)
     this->insertDeadNonceList(*pitEntry, &inFace);
@@ -343,7 +513,11 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
   // when more than one PIT entry is matched, trigger strategy: before satisfy Interest,
   // and send Data to all matched out faces
   else {
-    std::set<Face*> pendingDownstreams;
+    // Each face is marked with the generation of this Data when first seen, so that
+    // downstreams shared by several PIT entries are collected once, in first-seen order.
+    std::vector<Face*> pendingDownstreams;
+    pendingDownstreams.reserve(pitMatches.size());
+    uint64_t generation = ++m_downstreamGeneration;
     auto now = time::steady_clock::now();
 
     for (const shared_ptr<pit::Entry>& pitEntry : pitMatches) {
@@ -351,8 +525,14 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
 
       // remember pending downstreams
       for (const pit::InRecord& inRecord : pitEntry->getInRecords()) {
-        if (inRecord.getExpiry() > now) {
-          pendingDownstreams.insert(&inRecord.getFace());
+        if (inRecord.getExpiry() <= now) {
+          continue;
+        }
+        Face& downstream = inRecord.getFace();
+        uint64_t& mark = downstream.getTableReferences().downstreamGeneration;
+        if (mark != generation) {
+          mark = generation;
+          pendingDownstreams.push_back(&downstream);
         }
       }
 
@@ -364,9 +544,10 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
       this->dispatchToStrategy(*pitEntry,
         [&] (fw::Strategy& strategy) { strategy.beforeSatisfyInterest(pitEntry, inFace, data); });
 
-      // mark PIT satisfied
+      // mark PIT satisfied; a pending lookup can no longer serve it
       pitEntry->isSatisfied = true;
       pitEntry->dataFreshnessPeriod = data.getFreshnessPeriod();
+      pitEntry->pendingCsLookup = 0;
 
       // Dead Nonce List insert if necessary (for out-record of inFace)
       this->insertDeadNonceList(*pitEntry, &inFace);
@@ -436,7 +617,7 @@ void
 Forwarder::onIncomingNack(Face& inFace, const lp::Nack& nack)
 {
   // receive Nack
-  nack.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
+  nack.setTag(inFace.getIncomingFaceIdTag());
   ++m_counters.nInNacks;
 
   // if multi-access or ad hoc face, drop
@@ -551,9 +732,20 @@ Forwarder::setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::millisec
   BOOST_ASSERT(pitEntry);
   BOOST_ASSERT(duration >= 0_ms);
 
-  scheduler::cancel(pitEntry->expiryTimer);
+  m_pitExpiryTimers.cancel(pitEntry->expiryTimer);
+
+  // the PIT entry is kept in the timer node, so that scheduling does not allocate
+  pitEntry->expiryTimer = m_pitExpiryTimers.schedule(duration, pitEntry);
+}
+
+void
+Forwarder::setExpiryTimerToLastInRecord(const shared_ptr<pit::Entry>& pitEntry)
+{
+  BOOST_ASSERT(pitEntry->hasInRecords());
 
-  pitEntry->expiryTimer = scheduler::schedule((duration), [=] { onInterestFinalize(pitEntry); });
+  auto lastExpiring = std::max_element(pitEntry->in_begin(), pitEntry->in_end(), &compare_InRecord_expiry);
+  auto lastExpiryFromNow = lastExpiring->getExpiry() - time::steady_clock::now();
+  this->setExpiryTimer(pitEntry, time::duration_cast<time::milliseconds>(lastExpiryFromNow));
 }
 
 void
@@ -27,7 +27,7 @@
 #define NFD_DAEMON_FW_FORWARDER_HPP
 
 #include "core/common.hpp"
-#include "core/scheduler.hpp"
+#include "core/timing-wheel.hpp"
 #include "forwarder-counters.hpp"
 #include "face-table.hpp"
 #include "unsolicited-data-policy.hpp"
@@ -136,6 +136,18 @@ public: // forwarding entrypoints and tables
     this->onIncomingNack(face, nack);
   }
 
+  /** \brief start processing a batch of Interests and Data received in a burst
+   *  \param face face on which the packets are received
+   *  \param batch the incoming packets, each meeting the requirements of
+   *               startProcessInterest or startProcessData
+   *  \pre batch.size() <= face::LinkService::MAX_RECEIVE_BATCH
+   *
+   *  The name tree buckets of all packets are prefetched before the packets are processed
+   *  one after another in arrival order.
+   */
+  void
+  startProcessBatch(Face& face, const face::ReceiveBatch& batch);
+
   NameTree&
   getNameTree()
   {
@@ -224,6 +236,28 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   onContentStoreHit(const Face& inFace, const shared_ptr<pit::Entry>& pitEntry,
                     const Interest& interest, const Data& data);
 
+  /** \brief start Content Store lookup for a PIT entry without in-records
+   *
+   *  If the Content Store does not decide before find() returns, an in-record is inserted
+   *  so that the PIT entry is held until the decision arrives, and the pipeline continues
+   *  in onDeferredContentStoreHit or onDeferredContentStoreMiss.
+   */
+  void
+  lookupContentStore(Face& inFace, const shared_ptr<pit::Entry>& pitEntry, const Interest& interest);
+
+  /** \brief Content Store hit pipeline, after a deferred lookup
+   *
+   *  The Data is returned to every downstream aggregated while the lookup was pending.
+   */
+  VIRTUAL_WITH_TESTS void
+  onDeferredContentStoreHit(const shared_ptr<pit::Entry>& pitEntry, const Data& data);
+
+  /** \brief Content Store miss pipeline, after a deferred lookup
+   *  \param inFaceId the downstream that started the lookup
+   */
+  VIRTUAL_WITH_TESTS void
+  onDeferredContentStoreMiss(FaceId inFaceId, const shared_ptr<pit::Entry>& pitEntry);
+
   /** \brief outgoing Interest pipeline
    */
   VIRTUAL_WITH_TESTS void
@@ -268,6 +302,12 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   void
   setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::milliseconds duration);
 
+  /** \brief set a new expiry timer on a PIT entry, to the time that the last in-record expires
+   *  \pre pitEntry->hasInRecords()
+   */
+  void
+  setExpiryTimerToLastInRecord(const shared_ptr<pit::Entry>& pitEntry);
+
   /** \brief insert Nonce to Dead Nonce List if necessary
    *  \param upstream if null, insert Nonces from all out-records;
    *                  if not null, insert Nonce only on the out-records of this face
@@ -305,8 +345,16 @@ private:
   NetworkRegionTable m_networkRegionTable;
   shared_ptr<Face>   m_csFace;
 
+  /** \brief timers of PIT entry expiry
+   *  \note Pending timers hold PIT entries, so this must be destructed before the tables.
+   */
+  scheduler::TimingWheel m_pitExpiryTimers;
+
   ns3::Ptr<ns3::ndn::ContentStore> m_csFromNdnSim;
 
+  uint64_t m_lastCsLookupId = 0; ///< identifies Content Store lookups, see pit::Entry::pendingCsLookup
+  uint64_t m_downstreamGeneration = 0; ///< see face::TableReferences::downstreamGeneration
+
   // allow Strategy (base class) to enter pipelines
   friend class fw::Strategy;
 };
@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_SHARD_SELECTOR_HPP
+#define NFD_DAEMON_FW_SHARD_SELECTOR_HPP
+
+#include "table/name-tree-hashtable.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief assigns Names to shards of forwarding state
+ *
+ *  When PIT, CS, and Measurements are partitioned into shards, each owned by a worker thread,
+ *  a packet is dispatched to the shard selected by the hash of the first \p prefixLen
+ *  components of its Name. An Interest and the Data that satisfies it are assigned to the
+ *  same shard, provided that the Interest Name has at least \p prefixLen components;
+ *  a shorter Name is assigned by the hash of all its components.
+ */
+class ShardSelector
+{
+public:
+  /** \pre nShards > 0
+   *  \pre prefixLen > 0
+   */
+  ShardSelector(size_t nShards, size_t prefixLen);
+
+  size_t
+  getNShards() const
+  {
+    return m_nShards;
+  }
+
+  size_t
+  getPrefixLength() const
+  {
+    return m_prefixLen;
+  }
+
+  /** \return index of the shard that owns \p name, in [0, getNShards())
+   */
+  size_t
+  operator()(const Name& name) const
+  {
+    return name_tree::computeHash(name, m_prefixLen) % m_nShards;
+  }
+
+private:
+  size_t m_nShards;
+  size_t m_prefixLen;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_SHARD_SELECTOR_HPP
@@ -250,6 +250,7 @@ main(int argc, char** argv)
   using namespace nfd;
 
   std::string configFile = DEFAULT_CONFIG_FILE;
+  size_t asyncLogCapacity = 0;
 
   po::options_description description("Options");
   description.add_options()
@@ -258,6 +259,9 @@ main(int argc, char** argv)
     ("config,c",  po::value<std::string>(&configFile),
                   "path to configuration file (default: " DEFAULT_CONFIG_FILE ")")
     ("modules,m", "list available logging modules")
+    ("async-log", po::value<size_t>(&asyncLogCapacity),
+                  "write log messages from a background thread, queueing up to the given "
+                  "number of messages per thread; excess messages are dropped")
     ;
 
   po::variables_map vm;
@@ -316,6 +320,12 @@ main(int argc, char** argv)
                ", with ndn-cxx version " NDN_CXX_VERSION_BUILD_STRING
             << std::endl;
 
+  // must outlive the runner, whose threads may log
+  optional<AsyncLogBackend> asyncLog;
+  if (asyncLogCapacity > 0) {
+    asyncLog.emplace(asyncLogCapacity, std::clog);
+  }
+
   NfdRunner runner(configFile);
   try {
     runner.initialize();
@@ -24,12 +24,22 @@
  */
 
 #include "cs-manager.hpp"
+#include "table/cs-snapshot.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
 #include <ndn-cxx/mgmt/nfd/cs-info.hpp>
 
 namespace nfd {
 
 constexpr size_t CsManager::ERASE_LIMIT;
 
+CsSnapshotCommand::CsSnapshotCommand()
+  : ControlCommand("cs", "snapshot")
+{
+  m_responseValidator
+    .required(ndn::nfd::CONTROL_PARAMETER_COUNT);
+}
+
 CsManager::CsManager(Cs& cs, const ForwarderCounters& fwCnt,
                      Dispatcher& dispatcher, CommandAuthenticator& authenticator)
   : NfdManagerBase(dispatcher, authenticator, "cs")
@@ -40,8 +50,15 @@ CsManager::CsManager(Cs& cs, const ForwarderCounters& fwCnt,
     bind(&CsManager::changeConfig, this, _4, _5));
   registerCommandHandler<ndn::nfd::CsEraseCommand>("erase",
     bind(&CsManager::erase, this, _4, _5));
+  registerCommandHandler<CsEraseStartCommand>("erase-start",
+    bind(&CsManager::startEraseJob, this, _4, _5));
+  registerCommandHandler<CsEraseCancelCommand>("erase-cancel",
+    bind(&CsManager::cancelEraseJob, this, _4, _5));
+  registerCommandHandler<CsSnapshotCommand>("snapshot",
+    bind(&CsManager::saveSnapshot, this, _4, _5));
 
   registerStatusDatasetHandler("info", bind(&CsManager::serveInfo, this, _1, _2, _3));
+  registerStatusDatasetHandler("erase-jobs", bind(&CsManager::serveEraseJobs, this, _1, _2, _3));
 }
 
 void
@@ -97,6 +114,72 @@ CsManager::erase(const ControlParameters& parameters,
     });
 }
 
+void
+CsManager::startEraseJob(const ControlParameters& parameters,
+                         const ndn::mgmt::CommandContinuation& done)
+{
+  const Name& prefix = parameters.getName();
+  m_cs.startEraseJob(prefix);
+
+  ControlParameters body;
+  body.setName(prefix);
+  body.setCount(m_cs.getEraseJobs().at(prefix).nErased);
+  done(ControlResponse(200, "OK").setBody(body.wireEncode()));
+}
+
+void
+CsManager::cancelEraseJob(const ControlParameters& parameters,
+                          const ndn::mgmt::CommandContinuation& done)
+{
+  const Name& prefix = parameters.getName();
+  optional<size_t> nErased = m_cs.cancelEraseJob(prefix);
+  if (!nErased) {
+    done(ControlResponse(404, "No erase job for this prefix"));
+    return;
+  }
+
+  ControlParameters body;
+  body.setName(prefix);
+  body.setCount(*nErased);
+  done(ControlResponse(200, "OK").setBody(body.wireEncode()));
+}
+
+void
+CsManager::saveSnapshot(const ControlParameters& parameters,
+                        const ndn::mgmt::CommandContinuation& done)
+{
+  if (m_cs.getSnapshotPath().empty()) {
+    done(ControlResponse(409, "CS snapshot is not configured"));
+    return;
+  }
+
+  size_t nSaved = 0;
+  try {
+    nSaved = cs::saveSnapshot(m_cs, m_cs.getSnapshotPath());
+  }
+  catch (const cs::SnapshotError& e) {
+    done(ControlResponse(500, e.what()));
+    return;
+  }
+
+  ControlParameters body;
+  body.setCount(nSaved);
+  done(ControlResponse(200, "OK").setBody(body.wireEncode()));
+}
+
+void
+CsManager::serveEraseJobs(const Name& topPrefix, const Interest& interest,
+                          ndn::mgmt::StatusDatasetContext& context) const
+{
+  for (const auto& job : m_cs.getEraseJobs()) {
+    CsEraseJob item;
+    item.setName(job.first);
+    item.setNErased(job.second.nErased);
+    context.append(item.wireEncode());
+  }
+  context.end();
+}
+
 void
 CsManager::serveInfo(const Name& topPrefix, const Interest& interest,
                      ndn::mgmt::StatusDatasetContext& context) const
@@ -109,7 +192,17 @@ CsManager::serveInfo(const Name& topPrefix, const Interest& interest,
   info.setNHits(m_fwCnt.nCsHits);
   info.setNMisses(m_fwCnt.nCsMisses);
 
-  context.append(info.wireEncode());
+  Block block = info.wireEncode();
+  block.parse();
+  block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(TLV_CS_N_BYTES, m_cs.getBytes()));
+  block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(TLV_CS_MAX_BYTES, m_cs.getByteLimit()));
+  block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(TLV_CS_N_MISS_FILTER_HITS,
+                                                             m_cs.getNMissFilterHits()));
+  block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(TLV_CS_N_MISS_FILTER_FALSE_POSITIVES,
+                                                             m_cs.getNMissFilterFalsePositives()));
+  block.encode();
+
+  context.append(block);
   context.end();
 }
 
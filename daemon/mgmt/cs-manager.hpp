@@ -27,11 +27,23 @@
 #define NFD_DAEMON_MGMT_CS_MANAGER_HPP
 
 #include "nfd-manager-base.hpp"
+#include "core/cs-erase-job.hpp"
 #include "table/cs.hpp"
 #include "fw/forwarder-counters.hpp"
 
 namespace nfd {
 
+/** \brief represents a cs/snapshot command
+ *
+ *  It saves CS contents to the configured snapshot file. The response carries Count,
+ *  the number of saved Data.
+ */
+class CsSnapshotCommand : public ndn::nfd::ControlCommand
+{
+public:
+  CsSnapshotCommand();
+};
+
 /** \brief Implement the CS Management of NFD Management Protocol.
  *  \sa https://redmine.named-data.net/projects/nfd/wiki/CsMgmt
  */
@@ -54,6 +66,32 @@ private:
   erase(const ControlParameters& parameters,
         const ndn::mgmt::CommandContinuation& done);
 
+  /** \brief Process cs/erase-start command.
+   */
+  void
+  startEraseJob(const ControlParameters& parameters,
+                const ndn::mgmt::CommandContinuation& done);
+
+  /** \brief Process cs/erase-cancel command.
+   */
+  void
+  cancelEraseJob(const ControlParameters& parameters,
+                 const ndn::mgmt::CommandContinuation& done);
+
+  /** \brief Process cs/snapshot command.
+   */
+  void
+  saveSnapshot(const ControlParameters& parameters,
+               const ndn::mgmt::CommandContinuation& done);
+
+  /** \brief Serve background erase jobs dataset.
+   *
+   *  Each running job is represented by a CsEraseJob block.
+   */
+  void
+  serveEraseJobs(const Name& topPrefix, const Interest& interest,
+                 ndn::mgmt::StatusDatasetContext& context) const;
+
   /** \brief Serve CS information dataset.
    */
   void
@@ -63,6 +101,18 @@ private:
 public:
   static constexpr size_t ERASE_LIMIT = 256;
 
+  /** \brief TLV-TYPE numbers of fields appended to CsInfo in cs/info dataset
+   *
+   *  These are non-critical (even numbers greater than 31), so that
+   *  CsInfo decoders unaware of them ignore them.
+   */
+  enum : uint32_t {
+    TLV_CS_N_BYTES = 0xC0,   ///< total wire size of stored Data, in octets
+    TLV_CS_MAX_BYTES = 0xC2, ///< capacity in octets
+    TLV_CS_N_MISS_FILTER_HITS = 0xC4, ///< lookups answered as misses by the miss filter
+    TLV_CS_N_MISS_FILTER_FALSE_POSITIVES = 0xC6, ///< verified miss filter hits that found Data
+  };
+
 private:
   Cs& m_cs;
   const ForwarderCounters& m_fwCnt;
@@ -25,6 +25,7 @@
 
 #include "forwarder-status-manager.hpp"
 #include "fw/forwarder.hpp"
+#include "core/latency-tlv.hpp"
 #include "core/version.hpp"
 
 namespace nfd {
@@ -38,6 +39,8 @@ ForwarderStatusManager::ForwarderStatusManager(Forwarder& forwarder, Dispatcher&
 {
   m_dispatcher.addStatusDataset("status/general", ndn::mgmt::makeAcceptAllAuthorization(),
                                 bind(&ForwarderStatusManager::listGeneralStatus, this, _1, _2, _3));
+  m_dispatcher.addStatusDataset("status/latency", ndn::mgmt::makeAcceptAllAuthorization(),
+                                bind(&ForwarderStatusManager::listLatency, this, _1, _2, _3));
 }
 
 ndn::nfd::ForwarderStatus
@@ -83,4 +86,43 @@ ForwarderStatusManager::listGeneralStatus(const Name& topPrefix, const Interest&
   context.end();
 }
 
+static Block
+encodeStageLatency(const std::string& stageName, const LatencyHistogram& histogram)
+{
+  using namespace ndn::encoding;
+
+  Block block(latency_tlv::PipelineStageLatency);
+  block.push_back(makeStringBlock(latency_tlv::StageName, stageName));
+  block.push_back(makeNonNegativeIntegerBlock(latency_tlv::NSamples,
+                                              histogram.getCount()));
+  block.push_back(makeNonNegativeIntegerBlock(latency_tlv::TotalNanoseconds,
+                                              histogram.getTotal()));
+
+  const auto& buckets = histogram.getBuckets();
+  auto end = std::find_if(buckets.rbegin(), buckets.rend(),
+                          [] (uint64_t count) { return count != 0; }).base();
+  for (auto it = buckets.begin(); it != end; ++it) {
+    block.push_back(makeNonNegativeIntegerBlock(latency_tlv::BucketCount, *it));
+  }
+
+  block.encode();
+  return block;
+}
+
+void
+ForwarderStatusManager::listLatency(const Name& topPrefix, const Interest& interest,
+                                    ndn::mgmt::StatusDatasetContext& context)
+{
+  context.setExpiry(STATUS_FRESHNESS);
+
+  const ForwarderCounters& counters = m_forwarder.getCounters();
+  context.append(encodeStageLatency("incoming-interest", counters.inInterestLatency));
+  context.append(encodeStageLatency("cs-lookup", counters.csLookupLatency));
+  context.append(encodeStageLatency("strategy-after-receive-interest", counters.strategyLatency));
+  context.append(encodeStageLatency("outgoing-interest", counters.outInterestLatency));
+  context.append(encodeStageLatency("incoming-data", counters.inDataLatency));
+  context.append(encodeStageLatency("pit-match", counters.pitMatchLatency));
+  context.end();
+}
+
 } // namespace nfd
@@ -52,6 +52,15 @@ private:
   listGeneralStatus(const Name& topPrefix, const Interest& interest,
                     ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief provide pipeline stage latency dataset
+   *
+   *  The dataset contains one PipelineStageLatency block per stage.
+   *  \sa latency_tlv
+   */
+  void
+  listLatency(const Name& topPrefix, const Interest& interest,
+              ndn::mgmt::StatusDatasetContext& context);
+
 private:
   Forwarder&  m_forwarder;
   Dispatcher& m_dispatcher;
@@ -25,10 +25,19 @@
 
 #include "tables-config-section.hpp"
 #include "fw/strategy.hpp"
+#include "core/logger.hpp"
+#include "table/cs-snapshot.hpp"
+
+#include <boost/filesystem/operations.hpp>
+
+#include <fstream>
 
 namespace nfd {
 
+NFD_LOG_INIT(TablesConfigSection);
+
 const size_t TablesConfigSection::DEFAULT_CS_MAX_PACKETS = 65536;
+const size_t TablesConfigSection::DEFAULT_CS_MAX_BYTES = std::numeric_limits<size_t>::max();
 
 TablesConfigSection::TablesConfigSection(Forwarder& forwarder)
   : m_forwarder(forwarder)
@@ -51,6 +60,7 @@ TablesConfigSection::ensureConfigured()
   }
 
   m_forwarder.getCs().setLimit(DEFAULT_CS_MAX_PACKETS);
+  m_forwarder.getCs().setByteLimit(DEFAULT_CS_MAX_BYTES);
   // Don't set default cs_policy because it's already created by CS itself.
   m_forwarder.setUnsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>());
 
@@ -66,6 +76,12 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     nCsMaxPackets = ConfigFile::parseNumber<size_t>(*csMaxPacketsNode, "cs_max_packets", "tables");
   }
 
+  size_t nCsMaxBytes = DEFAULT_CS_MAX_BYTES;
+  OptionalConfigSection csMaxBytesNode = section.get_child_optional("cs_max_bytes");
+  if (csMaxBytesNode) {
+    nCsMaxBytes = ConfigFile::parseNumber<size_t>(*csMaxBytesNode, "cs_max_bytes", "tables");
+  }
+
   unique_ptr<cs::Policy> csPolicy;
   OptionalConfigSection csPolicyNode = section.get_child_optional("cs_policy");
   if (csPolicyNode) {
@@ -91,6 +107,30 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     unsolicitedDataPolicy = make_unique<fw::DefaultUnsolicitedDataPolicy>();
   }
 
+  boost::filesystem::path csSnapshotPath;
+  OptionalConfigSection csSnapshotNode = section.get_child_optional("cs_snapshot");
+  if (csSnapshotNode) {
+    csSnapshotPath = csSnapshotNode->get_value<std::string>();
+    if (csSnapshotPath.empty()) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Empty cs_snapshot in \"tables\" section"));
+    }
+  }
+
+  bool wantFibPrefixLengthSearch = false;
+  OptionalConfigSection fibPrefixLengthSearchNode = section.get_child_optional("fib_prefix_length_search");
+  if (fibPrefixLengthSearchNode) {
+    wantFibPrefixLengthSearch = ConfigFile::parseYesNo(*fibPrefixLengthSearchNode,
+                                                       "fib_prefix_length_search", "tables");
+  }
+
+  OptionalConfigSection csDiskSection = section.get_child_optional("cs_disk");
+  if (csDiskSection) {
+    processCsDiskSection(*csDiskSection, isDryRun);
+  }
+  else if (!isDryRun) {
+    m_forwarder.getCs().setDiskTier(nullptr);
+  }
+
   OptionalConfigSection strategyChoiceSection = section.get_child_optional("strategy_choice");
   if (strategyChoiceSection) {
     processStrategyChoiceSection(*strategyChoiceSection, isDryRun);
@@ -107,12 +147,27 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
 
   Cs& cs = m_forwarder.getCs();
   cs.setLimit(nCsMaxPackets);
+  cs.setByteLimit(nCsMaxBytes);
   if (cs.size() == 0 && csPolicy != nullptr) {
     cs.setPolicy(std::move(csPolicy));
   }
 
+  // a snapshot is restored only at startup, after capacity and policy are known
+  bool shouldRestore = cs.getSnapshotPath().empty() && cs.size() == 0;
+  cs.setSnapshotPath(csSnapshotPath);
+  if (shouldRestore && !csSnapshotPath.empty() && boost::filesystem::exists(csSnapshotPath)) {
+    try {
+      cs::loadSnapshot(cs, csSnapshotPath);
+    }
+    catch (const cs::SnapshotError& e) {
+      NFD_LOG_WARN("Cannot restore CS snapshot: " << e.what());
+    }
+  }
+
   m_forwarder.setUnsolicitedDataPolicy(std::move(unsolicitedDataPolicy));
 
+  m_forwarder.getFib().enablePrefixLengthSearch(wantFibPrefixLengthSearch);
+
   m_isConfigured = true;
 }
 
@@ -169,4 +224,57 @@ TablesConfigSection::processNetworkRegionSection(const ConfigSection& section, b
   }
 }
 
+void
+TablesConfigSection::processCsDiskSection(const ConfigSection& section, bool isDryRun)
+{
+  OptionalConfigSection pathNode = section.get_child_optional("path");
+  if (!pathNode || pathNode->get_value<std::string>().empty()) {
+    BOOST_THROW_EXCEPTION(ConfigFile::Error("Missing path in \"cs_disk\" section"));
+  }
+  boost::filesystem::path path(pathNode->get_value<std::string>());
+
+  OptionalConfigSection maxBytesNode = section.get_child_optional("max_bytes");
+  if (!maxBytesNode) {
+    BOOST_THROW_EXCEPTION(ConfigFile::Error("Missing max_bytes in \"cs_disk\" section"));
+  }
+  size_t maxBytes = ConfigFile::parseNumber<size_t>(*maxBytesNode, "max_bytes", "tables.cs_disk");
+
+  if (isDryRun) {
+    // an unusable directory must be reported before any section is applied
+    namespace fs = boost::filesystem;
+    try {
+      fs::create_directories(path);
+      fs::path probe = path / fs::unique_path(".probe-%%%%-%%%%");
+      bool isWritable = static_cast<bool>(std::ofstream(probe.string()) << '\n');
+      boost::system::error_code ec;
+      fs::remove(probe, ec);
+      if (!isWritable) {
+        BOOST_THROW_EXCEPTION(ConfigFile::Error("Cannot write to " + path.string() +
+                                                " in \"cs_disk\" section"));
+      }
+    }
+    catch (const fs::filesystem_error& e) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(std::string(e.what()) + " in \"cs_disk\" section"));
+    }
+    return;
+  }
+
+  Cs& cs = m_forwarder.getCs();
+  const cs::DiskTier* diskTier = cs.getDiskTier();
+  if (diskTier != nullptr && diskTier->getPath() == path && diskTier->getMaxBytes() == maxBytes) {
+    return;
+  }
+
+  // open the new disk tier before closing the old one, so that a failure keeps the old one;
+  // if both use the same directory, the new one sees all records through the shared mappings
+  unique_ptr<cs::DiskTier> newDiskTier;
+  try {
+    newDiskTier = make_unique<cs::DiskTier>(path, maxBytes);
+  }
+  catch (const cs::DiskTier::Error& e) {
+    BOOST_THROW_EXCEPTION(ConfigFile::Error(std::string(e.what()) + " in \"cs_disk\" section"));
+  }
+  cs.setDiskTier(std::move(newDiskTier));
+}
+
 } // namespace nfd
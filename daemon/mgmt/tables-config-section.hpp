@@ -38,8 +38,16 @@ namespace nfd {
  *  tables
  *  {
  *    cs_max_packets 65536
+ *    cs_max_bytes 536870912
  *    cs_policy lru
  *    cs_unsolicited_policy drop-all
+ *    cs_snapshot /var/cache/nfd/cs.snapshot
+ *
+ *    cs_disk
+ *    {
+ *      path /var/cache/nfd/cs
+ *      max_bytes 4294967296
+ *    }
  *
  *    strategy_choice
  *    {
@@ -58,8 +66,12 @@ namespace nfd {
  *  \endcode
  *
  *  During a configuration reload,
- *  \li cs_max_packets, cs_policy, and cs_unsolicited_policy are applied;
+ *  \li cs_max_packets, cs_max_bytes, cs_policy, and cs_unsolicited_policy are applied;
  *      defaults are used if an option is omitted.
+ *  \li cs_snapshot is applied; the snapshot is restored only if the CS is empty and
+ *      no snapshot path was configured before, which happens during initial configuration.
+ *  \li cs_disk is applied; the disk tier is disabled if the section is omitted,
+ *      and is reopened only if path or max_bytes changes.
  *  \li strategy_choice entries are inserted, but old entries are not deleted.
  *  \li network_region is applied; it's kept unchanged if the section is omitted.
  *
@@ -91,8 +103,12 @@ private:
   void
   processNetworkRegionSection(const ConfigSection& section, bool isDryRun);
 
+  void
+  processCsDiskSection(const ConfigSection& section, bool isDryRun);
+
 private:
   static const size_t DEFAULT_CS_MAX_PACKETS;
+  static const size_t DEFAULT_CS_MAX_BYTES;
 
   Forwarder& m_forwarder;
 
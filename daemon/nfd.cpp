@@ -40,6 +40,7 @@
 #include "mgmt/general-config-section.hpp"
 #include "mgmt/strategy-choice-manager.hpp"
 #include "mgmt/tables-config-section.hpp"
+#include "table/cs-snapshot.hpp"
 
 namespace nfd {
 
@@ -68,7 +69,12 @@ Nfd::Nfd(const ConfigSection& config, ndn::KeyChain& keyChain)
 // It is necessary to explicitly define the destructor, because some member variables (e.g.,
 // unique_ptr<Forwarder>) are forward-declared, but implicitly declared destructor requires
 // complete types for all members when instantiated.
-Nfd::~Nfd() = default;
+Nfd::~Nfd()
+{
+  if (m_forwarder != nullptr) {
+    this->saveCsSnapshot();
+  }
+}
 
 void
 Nfd::initialize()
@@ -195,6 +201,22 @@ Nfd::reloadConfigFile()
   }
 }
 
+void
+Nfd::saveCsSnapshot()
+{
+  const Cs& cs = m_forwarder->getCs();
+  if (cs.getSnapshotPath().empty()) {
+    return;
+  }
+
+  try {
+    cs::saveSnapshot(cs, cs.getSnapshotPath());
+  }
+  catch (const cs::SnapshotError& e) {
+    NFD_LOG_WARN("Cannot save CS snapshot: " << e.what());
+  }
+}
+
 void
 Nfd::reloadConfigFileFaceSection()
 {
@@ -108,6 +108,12 @@ private:
   void
   reloadConfigFileFaceSection();
 
+  /**
+   * \brief Save Content Store snapshot, if a snapshot path is configured
+   */
+  void
+  saveCsSnapshot();
+
 private:
   std::string m_configFile;
   ConfigSection m_configSection;
@@ -24,38 +24,61 @@
  */
 
 #include "cleanup.hpp"
+#include "core/logger.hpp"
 
 namespace nfd {
 
-void
+NFD_LOG_INIT(TableCleanup);
+
+CleanupResult
 cleanupOnFaceRemoval(NameTree& nt, Fib& fib, Pit& pit, const Face& face)
 {
-  std::multimap<size_t, const name_tree::Entry*> maybeEmptyNtes;
+  face::TableReferences& refs = face.getTableReferences();
+  // name tree entries that may have become empty, deepest first
+  std::set<std::pair<size_t, name_tree::Entry*>, std::greater<std::pair<size_t, name_tree::Entry*>>>
+    maybeEmptyNtes;
 
-  // visit FIB and PIT entries in one pass of NameTree enumeration
-  for (const name_tree::Entry& nte : nt) {
-    fib::Entry* fibEntry = nte.getFibEntry();
-    if (fibEntry != nullptr) {
-      fib.removeNextHopByFace(*fibEntry, face);
-    }
+  // visit only FIB entries referencing the face;
+  // each FibReference is unlinked when the last nexthop on the face is removed
+  CleanupResult result;
+  while (!refs.fib.empty()) {
+    fib::Entry& fibEntry = refs.fib.front().getEntry();
+    name_tree::Entry* nte = nt.getEntry(fibEntry);
+    fib.removeNextHopByFace(fibEntry, face);
+    ++result.nFibEntries;
 
-    for (const auto& pitEntry : nte.getPitEntries()) {
-      pit.deleteInOutRecords(pitEntry.get(), face);
+    if (nte != nullptr && !nte->hasTableEntries()) {
+      maybeEmptyNtes.emplace(nte->getName().size(), nte);
     }
+  }
 
-    if (!nte.hasTableEntries()) {
-      maybeEmptyNtes.emplace(nte.getName().size(), &nte);
-    }
+  // visit only PIT entries with an in-record or out-record on the face;
+  // PIT entries are not erased, so their name tree entries stay non-empty
+  while (!refs.pit.empty()) {
+    pit::Entry* pitEntry = refs.pit.front().getEntry();
+    BOOST_ASSERT(pitEntry != nullptr);
+    pit.deleteInOutRecords(pitEntry, face);
+    ++result.nPitEntries;
   }
 
   // try to erase longer names first, so that children are erased before parent is checked
-  for (auto i = maybeEmptyNtes.rbegin(); i != maybeEmptyNtes.rend(); ++i) {
-    nt.eraseIfEmpty(const_cast<name_tree::Entry*>(i->second), false);
+  while (!maybeEmptyNtes.empty()) {
+    name_tree::Entry* nte = maybeEmptyNtes.begin()->second;
+    maybeEmptyNtes.erase(maybeEmptyNtes.begin());
+
+    name_tree::Entry* parent = nte->getParent();
+    if (nt.eraseIfEmpty(nte, false) > 0 && parent != nullptr) {
+      maybeEmptyNtes.emplace(parent->getName().size(), parent);
+    }
   }
 
+  NFD_LOG_INFO("cleanupOnFaceRemoval face=" << face.getId() << " fib-entries=" << result.nFibEntries
+               << " pit-entries=" << result.nPitEntries);
+
   BOOST_ASSERT(nt.size() == 0 ||
                std::none_of(nt.begin(), nt.end(),
                             [] (const name_tree::Entry& nte) { return nte.isEmpty(); }));
+  return result;
 }
 
 } // namespace nfd
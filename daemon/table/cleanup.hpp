@@ -32,19 +32,27 @@
 
 namespace nfd {
 
+/** \brief numbers of table entries visited by cleanupOnFaceRemoval
+ */
+struct CleanupResult
+{
+  size_t nFibEntries = 0;
+  size_t nPitEntries = 0;
+};
+
 /** \brief cleanup tables when a face is destroyed
  *
- *  This function enumerates the NameTree, calls Fib::removeNextHop for each FIB entry,
+ *  This function visits the FIB entries and PIT records that reference \p face,
+ *  as recorded in Face::getTableReferences(), calls Fib::removeNextHopByFace for each FIB entry,
  *  calls Pit::deleteInOutRecords for each PIT entry, and finally
  *  deletes any name tree entries that have become empty.
+ *  Its cost is proportional to the number of affected table entries, not the NameTree size.
+ *  \return numbers of visited FIB and PIT entries
  *
  *  \note It's a design choice to let Fib and Pit classes decide what to do with each entry.
  *        This function is only responsible for implementing the enumeration procedure.
- *        The benefit of having this function instead of doing the enumeration in Fib and Pit
- *        classes is to perform both FIB and PIT cleanups in one pass of NameTree enumeration,
- *        so as to reduce performance overhead.
  */
-void
+CleanupResult
 cleanupOnFaceRemoval(NameTree& nt, Fib& fib, Pit& pit, const Face& face);
 
 } // namespace nfd
@@ -0,0 +1,454 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-disk-tier.hpp"
+#include "core/logger.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace nfd {
+namespace cs {
+
+NFD_LOG_INIT(CsDiskTier);
+
+constexpr size_t DiskTier::N_SEGMENTS;
+constexpr size_t DiskTier::MIN_SEGMENT_SIZE;
+constexpr size_t DiskTier::MAX_SEGMENT_SIZE;
+
+/// max number of records examined by a lookup with CanBePrefix=true
+static constexpr size_t MAX_PREFIX_CANDIDATES = 16;
+
+static constexpr uint32_t RECORD_MAGIC = 0x5343444e;
+static const char SEGMENT_EXTENSION[] = ".seg";
+
+enum : uint32_t {
+  RECORD_DATA = 1,      ///< record contains a Data packet
+  RECORD_TOMBSTONE = 2, ///< record contains a Name whose Data has been erased
+};
+
+/** \brief header of a record in a segment file
+ *
+ *  A record is a header followed by a TLV block, padded to a multiple of 8 octets.
+ *  Segment files are zero-filled, so that a zero magic marks the end of records.
+ */
+struct RecordHeader
+{
+  uint32_t magic;
+  uint32_t type;
+  uint64_t length; ///< TLV block length
+  int64_t staleTime; ///< milliseconds since UNIX epoch
+};
+
+static size_t
+getRecordSize(size_t blockLength)
+{
+  return (sizeof(RecordHeader) + blockLength + 7) & ~size_t(7);
+}
+
+struct DiskTier::Segment : noncopyable
+{
+  ~Segment()
+  {
+    if (base != nullptr) {
+      ::munmap(base, size);
+    }
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+
+  uint64_t seqNo = 0;
+  boost::filesystem::path filename;
+  int fd = -1;
+  uint8_t* base = nullptr;
+  size_t size = 0;
+  size_t writeOffset = 0;
+  std::vector<Name> names; ///< Names of Data records, to clean up the index when dropped
+};
+
+/** \brief opens and maps a segment file
+ *  \param size if non-zero, the file is created and allocated with this size
+ *  \throw DiskTier::Error
+ */
+static void
+mapSegment(int& fd, uint8_t*& base, size_t& size, const boost::filesystem::path& filename)
+{
+  int flags = O_RDWR | O_CLOEXEC;
+  if (size > 0) {
+    flags |= O_CREAT | O_TRUNC;
+  }
+  fd = ::open(filename.c_str(), flags, 0644);
+  if (fd < 0) {
+    BOOST_THROW_EXCEPTION(DiskTier::Error("Cannot open " + filename.string() +
+                                          ": " + std::strerror(errno)));
+  }
+
+  if (size > 0) {
+    // allocate all blocks now: writing into a hole of a shared mapping raises SIGBUS
+    // when the filesystem is full, while posix_fallocate reports ENOSPC
+    int err = ::posix_fallocate(fd, 0, static_cast<off_t>(size));
+    if (err != 0) {
+      BOOST_THROW_EXCEPTION(DiskTier::Error("Cannot allocate " + filename.string() +
+                                            ": " + std::strerror(err)));
+    }
+  }
+  else {
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      BOOST_THROW_EXCEPTION(DiskTier::Error("Cannot stat " + filename.string() +
+                                            ": " + std::strerror(errno)));
+    }
+    size = static_cast<size_t>(st.st_size);
+    if (size < sizeof(RecordHeader)) {
+      return;
+    }
+  }
+
+  void* addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED) {
+    BOOST_THROW_EXCEPTION(DiskTier::Error("Cannot map " + filename.string() +
+                                          ": " + std::strerror(errno)));
+  }
+  base = static_cast<uint8_t*>(addr);
+}
+
+DiskTier::DiskTier(const boost::filesystem::path& path, size_t maxBytes)
+  : m_path(path)
+  , m_maxBytes(maxBytes)
+  , m_segmentSize(std::min(std::max(maxBytes / N_SEGMENTS, MIN_SEGMENT_SIZE), MAX_SEGMENT_SIZE))
+  , m_nBytes(0)
+{
+  this->openSegments();
+
+  while (m_nBytes > m_maxBytes && m_segments.size() > 1) {
+    this->dropOldestSegment();
+  }
+  NFD_LOG_INFO("opened " << m_path << " segments=" << m_segments.size() <<
+               " entries=" << m_index.size());
+}
+
+DiskTier::~DiskTier() = default;
+
+void
+DiskTier::openSegments()
+{
+  namespace fs = boost::filesystem;
+
+  std::vector<std::pair<uint64_t, fs::path>> files;
+  try {
+    fs::create_directories(m_path);
+    for (const fs::directory_entry& entry : fs::directory_iterator(m_path)) {
+      const fs::path& filename = entry.path();
+      std::string stem = filename.stem().string();
+      if (filename.extension() != SEGMENT_EXTENSION || stem.empty() ||
+          stem.find_first_not_of("0123456789") != std::string::npos) {
+        continue;
+      }
+      files.emplace_back(std::stoull(stem), filename);
+    }
+  }
+  catch (const std::exception& e) {
+    BOOST_THROW_EXCEPTION(Error("Cannot open " + m_path.string() + ": " + e.what()));
+  }
+  std::sort(files.begin(), files.end());
+
+  for (const auto& file : files) {
+    auto segment = make_unique<Segment>();
+    segment->seqNo = file.first;
+    segment->filename = file.second;
+    mapSegment(segment->fd, segment->base, segment->size, segment->filename);
+    if (segment->base == nullptr) {
+      segment.reset();
+      boost::system::error_code ec;
+      fs::remove(file.second, ec);
+      continue;
+    }
+
+    this->loadSegment(*segment);
+    m_nBytes += segment->size;
+    m_segments.push_back(std::move(segment));
+  }
+}
+
+void
+DiskTier::loadSegment(Segment& segment)
+{
+  size_t offset = 0;
+  while (offset + sizeof(RecordHeader) <= segment.size) {
+    RecordHeader header;
+    std::memcpy(&header, segment.base + offset, sizeof(header));
+    if (header.magic != RECORD_MAGIC ||
+        header.length > segment.size - offset - sizeof(header)) {
+      break;
+    }
+
+    try {
+      Block wire(segment.base + offset + sizeof(header), static_cast<size_t>(header.length));
+      if (header.type == RECORD_DATA) {
+        wire.parse();
+        Name name(wire.get(tlv::Name));
+        m_index[name] = Location{segment.seqNo, offset};
+        segment.names.push_back(std::move(name));
+      }
+      else if (header.type == RECORD_TOMBSTONE) {
+        m_index.erase(Name(wire));
+      }
+    }
+    catch (const tlv::Error& e) {
+      NFD_LOG_WARN("corrupted record in " << segment.filename << " at " << offset << ": " << e.what());
+      break;
+    }
+
+    offset += getRecordSize(static_cast<size_t>(header.length));
+  }
+  segment.writeOffset = offset;
+}
+
+void
+DiskTier::addSegment()
+{
+  while (!m_segments.empty() && m_nBytes + m_segmentSize > m_maxBytes) {
+    this->dropOldestSegment();
+  }
+
+  auto segment = make_unique<Segment>();
+  segment->seqNo = m_segments.empty() ? 1 : m_segments.back()->seqNo + 1;
+  segment->filename = m_path / (to_string(segment->seqNo) + SEGMENT_EXTENSION);
+  segment->size = m_segmentSize;
+  try {
+    mapSegment(segment->fd, segment->base, segment->size, segment->filename);
+  }
+  catch (const Error&) {
+    boost::filesystem::path filename = segment->filename;
+    segment.reset();
+    boost::system::error_code ec;
+    boost::filesystem::remove(filename, ec);
+    throw;
+  }
+
+  m_nBytes += segment->size;
+  m_segments.push_back(std::move(segment));
+}
+
+void
+DiskTier::dropOldestSegment()
+{
+  BOOST_ASSERT(!m_segments.empty());
+  unique_ptr<Segment> segment = std::move(m_segments.front());
+  m_segments.pop_front();
+  NFD_LOG_DEBUG("drop " << segment->filename);
+
+  for (const Name& name : segment->names) {
+    auto it = m_index.find(name);
+    if (it != m_index.end() && it->second.segmentSeqNo == segment->seqNo) {
+      m_index.erase(it);
+    }
+  }
+
+  m_nBytes -= segment->size;
+  boost::filesystem::path filename = segment->filename;
+  segment.reset();
+  boost::system::error_code ec;
+  boost::filesystem::remove(filename, ec);
+}
+
+optional<DiskTier::Location>
+DiskTier::appendRecord(uint32_t type, const Block& wire, time::system_clock::TimePoint staleTime)
+{
+  size_t recordSize = getRecordSize(wire.size());
+  if (recordSize > m_segmentSize) {
+    return nullopt;
+  }
+
+  if (m_segments.empty() ||
+      m_segments.back()->writeOffset + recordSize > m_segments.back()->size) {
+    this->addSegment();
+  }
+
+  Segment& segment = *m_segments.back();
+  size_t offset = segment.writeOffset;
+  RecordHeader header{RECORD_MAGIC, type, wire.size(),
+                      time::toUnixTimestamp(staleTime).count()};
+  std::memcpy(segment.base + offset + sizeof(header), wire.wire(), wire.size());
+  std::memcpy(segment.base + offset, &header, sizeof(header));
+  segment.writeOffset += recordSize;
+
+  return Location{segment.seqNo, offset};
+}
+
+DiskTier::Segment*
+DiskTier::getSegment(uint64_t seqNo) const
+{
+  if (m_segments.empty() || seqNo < m_segments.front()->seqNo) {
+    return nullptr;
+  }
+  size_t pos = static_cast<size_t>(seqNo - m_segments.front()->seqNo);
+  if (pos < m_segments.size() && m_segments[pos]->seqNo == seqNo) {
+    return m_segments[pos].get();
+  }
+
+  // seqNo can have gaps after corrupted segment files are skipped at startup
+  auto it = std::find_if(m_segments.begin(), m_segments.end(),
+                         [seqNo] (const auto& segment) { return segment->seqNo == seqNo; });
+  return it == m_segments.end() ? nullptr : it->get();
+}
+
+shared_ptr<Data>
+DiskTier::readData(const Location& loc, time::system_clock::TimePoint& staleTime) const
+{
+  Segment* segment = this->getSegment(loc.segmentSeqNo);
+  BOOST_ASSERT(segment != nullptr);
+
+  RecordHeader header;
+  std::memcpy(&header, segment->base + loc.offset, sizeof(header));
+  staleTime = time::fromUnixTimestamp(time::milliseconds(header.staleTime));
+
+  try {
+    Block wire(segment->base + loc.offset + sizeof(header), static_cast<size_t>(header.length));
+    return make_shared<Data>(wire);
+  }
+  catch (const tlv::Error& e) {
+    NFD_LOG_WARN("corrupted record in " << segment->filename << " at " << loc.offset << ": " << e.what());
+    return nullptr;
+  }
+}
+
+bool
+DiskTier::isSameData(const Location& loc, const Data& data) const
+{
+  Segment* segment = this->getSegment(loc.segmentSeqNo);
+  BOOST_ASSERT(segment != nullptr);
+
+  RecordHeader header;
+  std::memcpy(&header, segment->base + loc.offset, sizeof(header));
+  const Block& wire = data.wireEncode();
+  return header.length == wire.size() &&
+         std::memcmp(segment->base + loc.offset + sizeof(header), wire.wire(), wire.size()) == 0;
+}
+
+void
+DiskTier::insert(const Data& data, time::system_clock::TimePoint staleTime)
+{
+  auto it = m_index.find(data.getName());
+  if (it != m_index.end() && this->isSameData(it->second, data)) {
+    Segment* segment = this->getSegment(it->second.segmentSeqNo);
+    int64_t staleTimeMs = time::toUnixTimestamp(staleTime).count();
+    std::memcpy(segment->base + it->second.offset + offsetof(RecordHeader, staleTime),
+                &staleTimeMs, sizeof(staleTimeMs));
+    return;
+  }
+
+  optional<Location> loc = this->appendRecord(RECORD_DATA, data.wireEncode(), staleTime);
+  if (!loc) {
+    NFD_LOG_DEBUG("insert " << data.getName() << " too-large");
+    return;
+  }
+
+  NFD_LOG_TRACE("insert " << data.getName() << " segment=" << loc->segmentSeqNo);
+  m_index[data.getName()] = *loc;
+  this->getSegment(loc->segmentSeqNo)->names.push_back(data.getName());
+}
+
+shared_ptr<Data>
+DiskTier::find(const Interest& interest, time::system_clock::TimePoint& staleTime) const
+{
+  auto tryMatch = [&] (const Location& loc) -> shared_ptr<Data> {
+    shared_ptr<Data> data = this->readData(loc, staleTime);
+    if (data == nullptr || !interest.matchesData(*data)) {
+      return nullptr;
+    }
+    if (interest.getMustBeFresh() && staleTime < time::system_clock::now()) {
+      return nullptr;
+    }
+    return data;
+  };
+
+  const Name& name = interest.getName();
+  bool hasDigest = !name.empty() && name[-1].isImplicitSha256Digest();
+  if (!interest.getCanBePrefix() || hasDigest) {
+    auto it = m_index.find(name);
+    if (it != m_index.end()) {
+      shared_ptr<Data> data = tryMatch(it->second);
+      if (data != nullptr) {
+        return data;
+      }
+    }
+    if (hasDigest) {
+      it = m_index.find(name.getPrefix(-1));
+      if (it != m_index.end()) {
+        return tryMatch(it->second);
+      }
+    }
+    return nullptr;
+  }
+
+  size_t nCandidates = 0;
+  for (auto it = m_index.lower_bound(name);
+       it != m_index.end() && name.isPrefixOf(it->first) && nCandidates < MAX_PREFIX_CANDIDATES;
+       ++it, ++nCandidates) {
+    shared_ptr<Data> data = tryMatch(it->second);
+    if (data != nullptr) {
+      return data;
+    }
+  }
+  return nullptr;
+}
+
+size_t
+DiskTier::erase(const Name& prefix, size_t limit)
+{
+  std::vector<Name> names;
+  for (auto it = m_index.lower_bound(prefix);
+       it != m_index.end() && prefix.isPrefixOf(it->first) && names.size() < limit; ++it) {
+    names.push_back(it->first);
+  }
+
+  // tombstones keep erased Data from coming back when the index is rebuilt,
+  // so a Name leaves the index only after its tombstone is written
+  size_t nErased = 0;
+  for (const Name& name : names) {
+    try {
+      this->appendRecord(RECORD_TOMBSTONE, name.wireEncode(), time::system_clock::TimePoint());
+    }
+    catch (const Error& e) {
+      NFD_LOG_WARN("erase " << prefix << " stopped after " << nErased << ": " << e.what());
+      break;
+    }
+    m_index.erase(name);
+    ++nErased;
+  }
+  return nErased;
+}
+
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_DISK_TIER_HPP
+#define NFD_DAEMON_TABLE_CS_DISK_TIER_HPP
+
+#include "core/common.hpp"
+
+#include <boost/filesystem/path.hpp>
+
+#include <deque>
+
+namespace nfd {
+namespace cs {
+
+/** \brief a disk-backed second tier of the Content Store
+ *
+ *  Data packets are appended to a log of memory-mapped segment files in a directory.
+ *  An in-memory index maps each Data Name to the location of its latest record.
+ *  When the total size of segment files would exceed the limit, the oldest segment is dropped.
+ *  The index is rebuilt by scanning the segment files when the DiskTier is opened,
+ *  so that the cache stays warm across restarts.
+ *
+ *  Each record carries the time when the Data becomes stale, in system clock,
+ *  so that freshness is preserved across restarts.
+ *
+ *  Writes are synchronous: a record is copied into the mapped active segment by the caller.
+ *  When the active segment is full, the caller also waits for a new segment file to be
+ *  allocated on disk. Segment files are fully allocated when created, so that a full
+ *  filesystem is reported as an Error rather than a fault on a later write.
+ */
+class DiskTier : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /** \brief opens or creates a log in directory \p path
+   *  \param maxBytes limit of total size of segment files; at least one segment is kept
+   *  \throw Error the directory or a segment file cannot be opened
+   */
+  DiskTier(const boost::filesystem::path& path, size_t maxBytes);
+
+  ~DiskTier();
+
+  const boost::filesystem::path&
+  getPath() const
+  {
+    return m_path;
+  }
+
+  size_t
+  getMaxBytes() const
+  {
+    return m_maxBytes;
+  }
+
+  /** \return number of indexed Data packets
+   */
+  size_t
+  size() const
+  {
+    return m_index.size();
+  }
+
+  /** \return total size of segment files, in octets
+   */
+  size_t
+  getBytes() const
+  {
+    return m_nBytes;
+  }
+
+  /** \brief stores a Data packet
+   *
+   *  If the same Data packet is already stored, only its stale time is updated.
+   *  A Data packet that does not fit in a segment is not stored.
+   *  \throw Error a new segment file cannot be allocated; the Data packet is not stored
+   */
+  void
+  insert(const Data& data, time::system_clock::TimePoint staleTime);
+
+  /** \brief finds a Data packet that can satisfy \p interest
+   *  \param[out] staleTime the time when the found Data becomes stale
+   *  \return the Data, or nullptr if not found
+   *  \note ChildSelector is not considered; the leftmost match by Name is returned.
+   */
+  shared_ptr<Data>
+  find(const Interest& interest, time::system_clock::TimePoint& staleTime) const;
+
+  /** \brief erases Data packets under \p prefix
+   *  \param limit max number of Data packets to erase
+   *  \return number of erased Data packets, which is less than requested
+   *          if a new segment file cannot be allocated for tombstones
+   */
+  size_t
+  erase(const Name& prefix, size_t limit);
+
+private:
+  struct Segment;
+
+  struct Location
+  {
+    uint64_t segmentSeqNo;
+    size_t offset; ///< offset of record header within segment
+  };
+
+  using Index = std::map<Name, Location>;
+
+  void
+  openSegments();
+
+  /** \brief scans records of \p segment and adds them to the index
+   */
+  void
+  loadSegment(Segment& segment);
+
+  /** \brief creates a new active segment, dropping old segments to stay under the limit
+   *  \throw Error the segment file cannot be created or allocated
+   */
+  void
+  addSegment();
+
+  void
+  dropOldestSegment();
+
+  /** \brief appends a record to the active segment
+   *  \return location of the record, or nullopt if it does not fit in a segment
+   */
+  optional<Location>
+  appendRecord(uint32_t type, const Block& wire, time::system_clock::TimePoint staleTime);
+
+  Segment*
+  getSegment(uint64_t seqNo) const;
+
+  /** \brief decodes the Data packet of the record at \p loc
+   *  \return the Data, or nullptr if the record is corrupted
+   */
+  shared_ptr<Data>
+  readData(const Location& loc, time::system_clock::TimePoint& staleTime) const;
+
+  /** \brief checks whether \p data is the Data packet of the record at \p loc
+   */
+  bool
+  isSameData(const Location& loc, const Data& data) const;
+
+public:
+  /// segment file size is the limit divided by this, within [MIN_SEGMENT_SIZE, MAX_SEGMENT_SIZE]
+  static constexpr size_t N_SEGMENTS = 8;
+  static constexpr size_t MIN_SEGMENT_SIZE = 1 << 20;
+  static constexpr size_t MAX_SEGMENT_SIZE = 64 << 20;
+
+private:
+  boost::filesystem::path m_path;
+  size_t m_maxBytes;
+  size_t m_segmentSize;
+  size_t m_nBytes; ///< total size of segment files
+  std::deque<unique_ptr<Segment>> m_segments; ///< ordered by seqNo; the last one is active
+  Index m_index;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_DISK_TIER_HPP
@@ -25,6 +25,8 @@
 
 #include "cs-entry-impl.hpp"
 
+#include <cstring>
+
 namespace nfd {
 namespace cs {
 
@@ -56,22 +58,13 @@ EntryImpl::unsetUnsolicited()
 int
 compareQueryWithData(const Name& queryName, const Data& data)
 {
-  bool queryIsFullName = !queryName.empty() && queryName[-1].isImplicitSha256Digest();
-
-  int cmp = queryIsFullName ?
-            queryName.compare(0, queryName.size() - 1, data.getName()) :
-            queryName.compare(data.getName());
-
-  if (cmp != 0) { // Name without digest differs
+  int cmp = queryName.compare(data.getName());
+  if (cmp != 0) {
     return cmp;
   }
 
-  if (queryIsFullName) { // Name without digest equals, compare digest
-    return queryName[-1].compare(data.getFullName()[-1]);
-  }
-  else { // queryName is a proper prefix of Data fullName
-    return -1;
-  }
+  // queryName equals Data Name, and sorts before all Data with this Name
+  return -1;
 }
 
 int
@@ -82,7 +75,14 @@ compareDataWithData(const Data& lhs, const Data& rhs)
     return cmp;
   }
 
-  return lhs.getFullName()[-1].compare(rhs.getFullName()[-1]);
+  // Data with the same Name are ordered by wire encoding instead of implicit digest,
+  // which avoids computing SHA-256 on insertion; this is consistent with full name equality
+  const Block& lhsWire = lhs.wireEncode();
+  const Block& rhsWire = rhs.wireEncode();
+  if (lhsWire.size() != rhsWire.size()) {
+    return lhsWire.size() < rhsWire.size() ? -1 : 1;
+  }
+  return std::memcmp(lhsWire.wire(), rhsWire.wire(), lhsWire.size());
 }
 
 bool
@@ -58,12 +58,43 @@ public:
   bool
   operator<(const EntryImpl& other) const;
 
+public: // replacement policy state, not interpreted by CS
+  /** \return position of this entry in the replacement policy's index
+   */
+  size_t
+  getPolicyIndex() const
+  {
+    return m_policyIndex;
+  }
+
+  void
+  setPolicyIndex(size_t index)
+  {
+    m_policyIndex = index;
+  }
+
+  /** \return whether this entry has been used since the replacement policy last cleared the flag
+   */
+  bool
+  isReferenced() const
+  {
+    return m_isReferenced;
+  }
+
+  void
+  setReferenced(bool isReferenced)
+  {
+    m_isReferenced = isReferenced;
+  }
+
 private:
   bool
   isQuery() const;
 
 private:
   Name m_queryName;
+  size_t m_policyIndex = 0;
+  bool m_isReferenced = false;
 };
 
 } // namespace cs
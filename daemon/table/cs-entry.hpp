@@ -127,6 +127,16 @@ public: // used by generic ContentStore implementation
   void
   updateStaleTime();
 
+  /** \brief sets stale time to an absolute time
+   *  \pre hasData()
+   */
+  void
+  setStaleTime(const time::steady_clock::TimePoint& staleTime)
+  {
+    BOOST_ASSERT(this->hasData());
+    m_staleTime = staleTime;
+  }
+
   /** \brief clears the entry
    *  \post !hasData()
    */
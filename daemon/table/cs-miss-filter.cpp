@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-miss-filter.hpp"
+
+namespace nfd {
+namespace cs {
+
+constexpr size_t MissFilter::DEFAULT_CAPACITY;
+constexpr size_t MissFilter::BITS_PER_KEY;
+constexpr size_t MissFilter::N_HASHES;
+
+MissFilter::MissFilter(size_t capacity)
+  : m_capacity(std::max<size_t>(capacity, 1))
+{
+}
+
+size_t
+MissFilter::indexOf(name_tree::HashValue key, size_t i) const
+{
+  // double hashing: the i-th index is h1 + i * h2
+  uint64_t h1 = static_cast<uint64_t>(key);
+  uint64_t h2 = (h1 * 0x9e3779b97f4a7c15ULL) | 1;
+  h2 ^= h2 >> 29;
+  return static_cast<size_t>((h1 + i * h2) % (m_bits.size() * 64));
+}
+
+void
+MissFilter::add(name_tree::HashValue key)
+{
+  if (m_bits.empty()) {
+    m_bits.assign((m_capacity * BITS_PER_KEY + 63) / 64, 0);
+  }
+  if (m_size >= m_capacity) {
+    this->clear();
+  }
+
+  for (size_t i = 0; i < N_HASHES; ++i) {
+    size_t index = this->indexOf(key, i);
+    m_bits[index / 64] |= uint64_t(1) << (index % 64);
+  }
+  ++m_size;
+}
+
+bool
+MissFilter::contains(name_tree::HashValue key) const
+{
+  if (m_size == 0) {
+    return false;
+  }
+
+  for (size_t i = 0; i < N_HASHES; ++i) {
+    size_t index = this->indexOf(key, i);
+    if ((m_bits[index / 64] & (uint64_t(1) << (index % 64))) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool
+MissFilter::containsAny(const name_tree::HashSequence& keys) const
+{
+  return m_size > 0 &&
+         std::any_of(keys.begin(), keys.end(), [this] (auto key) { return this->contains(key); });
+}
+
+void
+MissFilter::clear()
+{
+  std::fill(m_bits.begin(), m_bits.end(), 0);
+  m_size = 0;
+}
+
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_MISS_FILTER_HPP
+#define NFD_DAEMON_TABLE_CS_MISS_FILTER_HPP
+
+#include "name-tree-hashtable.hpp"
+
+namespace nfd {
+namespace cs {
+
+/** \brief a Bloom filter of Names known to be absent from the Content Store
+ *
+ *  Keys are Name hashes computed by \c name_tree::computeHash.
+ *  When the number of added keys reaches the capacity, the filter is cleared before
+ *  the next key is added, so that the false positive rate stays around 1%.
+ *  Memory is allocated when the first key is added.
+ */
+class MissFilter : noncopyable
+{
+public:
+  explicit
+  MissFilter(size_t capacity = DEFAULT_CAPACITY);
+
+  /** \return number of keys added since the filter was last cleared
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  void
+  add(name_tree::HashValue key);
+
+  /** \return whether \p key may have been added; false positives are possible
+   */
+  bool
+  contains(name_tree::HashValue key) const;
+
+  /** \return whether any key in \p keys may have been added
+   */
+  bool
+  containsAny(const name_tree::HashSequence& keys) const;
+
+  void
+  clear();
+
+private:
+  size_t
+  indexOf(name_tree::HashValue key, size_t i) const;
+
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 65536;
+  static constexpr size_t BITS_PER_KEY = 10;
+  static constexpr size_t N_HASHES = 4;
+
+private:
+  std::vector<uint64_t> m_bits;
+  size_t m_capacity;
+  size_t m_size = 0;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_MISS_FILTER_HPP
@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-policy-clock.hpp"
+#include "cs.hpp"
+
+namespace nfd {
+namespace cs {
+namespace clock {
+
+const std::string ClockPolicy::POLICY_NAME = "clock";
+NFD_REGISTER_CS_POLICY(ClockPolicy);
+
+ClockPolicy::ClockPolicy()
+  : Policy(POLICY_NAME)
+  , m_hand(0)
+{
+}
+
+void
+ClockPolicy::doAfterInsert(iterator i)
+{
+  // evict before attaching, so that the new entry can take the slot vacated at the hand
+  while (this->isOverLimit() && m_slots.size() > m_freeSlots.size()) {
+    this->evictOne();
+  }
+
+  if (this->isOverLimit()) {
+    // the new entry alone exceeds the limit
+    this->emitSignal(beforeEvict, i);
+    return;
+  }
+
+  const_cast<EntryImpl&>(*i).setReferenced(false);
+  this->attachSlot(i);
+}
+
+void
+ClockPolicy::doAfterRefresh(iterator i)
+{
+  const_cast<EntryImpl&>(*i).setReferenced(true);
+}
+
+void
+ClockPolicy::doBeforeErase(iterator i)
+{
+  this->detachSlot(i);
+  this->compactIfSparse();
+}
+
+void
+ClockPolicy::doBeforeUse(iterator i)
+{
+  const_cast<EntryImpl&>(*i).setReferenced(true);
+}
+
+void
+ClockPolicy::evictEntries()
+{
+  BOOST_ASSERT(this->getCs() != nullptr);
+  while (this->isOverLimit()) {
+    this->evictOne();
+  }
+  this->compactIfSparse();
+}
+
+void
+ClockPolicy::doForEachInEvictionOrder(const EntryCallback& f) const
+{
+  // the hand sweeps forward from its current position
+  for (size_t n = 0, index = m_hand; n < m_slots.size(); ++n, ++index) {
+    if (index >= m_slots.size()) {
+      index = 0;
+    }
+    if (m_slots[index].isOccupied) {
+      f(m_slots[index].entry);
+    }
+  }
+}
+
+void
+ClockPolicy::attachSlot(iterator i)
+{
+  size_t index = 0;
+  if (m_freeSlots.empty()) {
+    index = m_slots.size();
+    m_slots.push_back({i, true});
+  }
+  else {
+    index = m_freeSlots.back();
+    m_freeSlots.pop_back();
+    m_slots[index] = {i, true};
+  }
+  const_cast<EntryImpl&>(*i).setPolicyIndex(index);
+}
+
+void
+ClockPolicy::detachSlot(iterator i)
+{
+  size_t index = i->getPolicyIndex();
+  BOOST_ASSERT(index < m_slots.size());
+  BOOST_ASSERT(m_slots[index].isOccupied && m_slots[index].entry == i);
+
+  m_slots[index].isOccupied = false;
+  m_freeSlots.push_back(index);
+}
+
+void
+ClockPolicy::evictOne()
+{
+  BOOST_ASSERT(m_slots.size() > m_freeSlots.size());
+
+  // terminates within two revolutions, because flags are cleared in the first revolution
+  while (true) {
+    if (m_hand >= m_slots.size()) {
+      m_hand = 0;
+    }
+    Slot& slot = m_slots[m_hand++];
+    if (!slot.isOccupied) {
+      continue;
+    }
+
+    EntryImpl& entry = const_cast<EntryImpl&>(*slot.entry);
+    if (entry.isReferenced()) {
+      entry.setReferenced(false);
+      continue;
+    }
+
+    iterator victim = slot.entry;
+    this->detachSlot(victim);
+    this->emitSignal(beforeEvict, victim);
+    return;
+  }
+}
+
+void
+ClockPolicy::compactIfSparse()
+{
+  if (m_freeSlots.size() * 2 <= m_slots.size()) {
+    return;
+  }
+
+  // keep circular order starting from the hand, so that the sweep resumes where it was
+  std::vector<Slot> slots;
+  slots.reserve(m_slots.size() - m_freeSlots.size());
+  for (size_t n = 0, index = m_hand; n < m_slots.size(); ++n, ++index) {
+    if (index >= m_slots.size()) {
+      index = 0;
+    }
+    if (m_slots[index].isOccupied) {
+      const_cast<EntryImpl&>(*m_slots[index].entry).setPolicyIndex(slots.size());
+      slots.push_back(m_slots[index]);
+    }
+  }
+
+  m_slots.swap(slots);
+  m_freeSlots.clear();
+  m_hand = 0;
+}
+
+} // namespace clock
+} // namespace cs
+} // namespace nfd
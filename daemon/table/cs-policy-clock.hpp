@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_POLICY_CLOCK_HPP
+#define NFD_DAEMON_TABLE_CS_POLICY_CLOCK_HPP
+
+#include "cs-policy.hpp"
+
+namespace nfd {
+namespace cs {
+namespace clock {
+
+/** \brief CLOCK cs replacement policy
+ *
+ *  This policy approximates LRU. Entries are kept in a circular array in insertion order,
+ *  and each entry has a reference flag. A lookup hit only sets the flag on the entry,
+ *  so that it costs O(1) and does not touch any shared structure.
+ *  To evict an entry, a hand sweeps the array: an entry with the flag set gets a second chance
+ *  by having its flag cleared; the first entry without the flag is evicted.
+ *  A new entry takes the slot behind the hand, so that it survives a full revolution.
+ */
+class ClockPolicy : public Policy
+{
+public:
+  ClockPolicy();
+
+public:
+  static const std::string POLICY_NAME;
+
+private:
+  void
+  doAfterInsert(iterator i) override;
+
+  void
+  doAfterRefresh(iterator i) override;
+
+  void
+  doBeforeErase(iterator i) override;
+
+  void
+  doBeforeUse(iterator i) override;
+
+  void
+  evictEntries() override;
+
+  void
+  doForEachInEvictionOrder(const EntryCallback& f) const override;
+
+private:
+  /** \brief places \p i into a free slot, preferably the one most recently vacated
+   */
+  void
+  attachSlot(iterator i);
+
+  /** \brief vacates the slot of \p i
+   */
+  void
+  detachSlot(iterator i);
+
+  /** \brief sweeps the hand until an entry is evicted
+   *  \pre at least one slot is occupied
+   */
+  void
+  evictOne();
+
+  /** \brief removes vacant slots if they take most of the array
+   */
+  void
+  compactIfSparse();
+
+private:
+  struct Slot
+  {
+    iterator entry;
+    bool isOccupied;
+  };
+
+  std::vector<Slot> m_slots;
+  std::vector<size_t> m_freeSlots; ///< indices of vacant slots, most recently vacated last
+  size_t m_hand;
+};
+
+} // namespace clock
+
+using clock::ClockPolicy;
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_POLICY_CLOCK_HPP
@@ -67,7 +67,7 @@ void
 LruPolicy::evictEntries()
 {
   BOOST_ASSERT(this->getCs() != nullptr);
-  while (this->getCs()->size() > this->getLimit()) {
+  while (this->isOverLimit()) {
     BOOST_ASSERT(!m_queue.empty());
     iterator i = m_queue.front();
     m_queue.pop_front();
@@ -75,6 +75,12 @@ LruPolicy::evictEntries()
   }
 }
 
+void
+LruPolicy::doForEachInEvictionOrder(const EntryCallback& f) const
+{
+  std::for_each(m_queue.begin(), m_queue.end(), f);
+}
+
 void
 LruPolicy::insertToQueue(iterator i, bool isNewEntry)
 {
@@ -85,6 +85,9 @@ private:
   virtual void
   evictEntries() override;
 
+  virtual void
+  doForEachInEvictionOrder(const EntryCallback& f) const override;
+
 private:
   /** \brief moves an entry to the end of queue
    */
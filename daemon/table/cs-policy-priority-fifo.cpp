@@ -76,11 +76,19 @@ PriorityFifoPolicy::evictEntries()
 {
   BOOST_ASSERT(this->getCs() != nullptr);
 
-  while (this->getCs()->size() > this->getLimit()) {
+  while (this->isOverLimit()) {
     this->evictOne();
   }
 }
 
+void
+PriorityFifoPolicy::doForEachInEvictionOrder(const EntryCallback& f) const
+{
+  for (const Queue& queue : m_queues) {
+    std::for_each(queue.begin(), queue.end(), f);
+  }
+}
+
 void
 PriorityFifoPolicy::evictOne()
 {
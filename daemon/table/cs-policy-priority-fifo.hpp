@@ -102,6 +102,9 @@ private:
   void
   evictEntries() override;
 
+  void
+  doForEachInEvictionOrder(const EntryCallback& f) const override;
+
 private:
   /** \brief evicts one entry
    *  \pre CS is not empty
@@ -0,0 +1,311 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-policy-tinylfu.hpp"
+#include "cs.hpp"
+#include "name-tree-hashtable.hpp"
+
+namespace nfd {
+namespace cs {
+namespace tinylfu {
+
+constexpr size_t FrequencySketch::DEPTH;
+constexpr uint8_t FrequencySketch::MAX_COUNT;
+
+/// counters per row are capped, so that sketch memory stays bounded with a huge limit
+static constexpr size_t MAX_SKETCH_WIDTH = 1 << 20;
+/// counters per key in each row; a wider sketch has fewer collisions
+static constexpr size_t COUNTERS_PER_KEY = 4;
+/// counters are halved after this many samples per counter in a row
+static constexpr size_t SAMPLES_PER_COUNTER = 10;
+
+static const uint64_t SKETCH_SEEDS[FrequencySketch::DEPTH] = {
+  0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL,
+};
+
+void
+FrequencySketch::resize(size_t nKeys)
+{
+  m_width = 16;
+  while (m_width / COUNTERS_PER_KEY < nKeys && m_width < MAX_SKETCH_WIDTH) {
+    m_width <<= 1;
+  }
+  m_counters.assign(DEPTH * m_width / 2, 0);
+  m_nSamples = 0;
+  m_sampleLimit = SAMPLES_PER_COUNTER * m_width;
+}
+
+size_t
+FrequencySketch::indexOf(size_t key, size_t row) const
+{
+  uint64_t h = (static_cast<uint64_t>(key) ^ SKETCH_SEEDS[row]) * 0x9e3779b97f4a7c15ULL;
+  h ^= h >> 32;
+  return row * m_width + static_cast<size_t>(h & (m_width - 1));
+}
+
+void
+FrequencySketch::increment(size_t key)
+{
+  if (m_width == 0) {
+    return;
+  }
+
+  // conservative update: only the smallest counters are incremented
+  uint8_t minCount = this->estimate(key);
+  if (minCount < MAX_COUNT) {
+    for (size_t row = 0; row < DEPTH; ++row) {
+      size_t index = this->indexOf(key, row);
+      if (this->getCounter(index) == minCount) {
+        this->incrementCounter(index);
+      }
+    }
+  }
+
+  if (++m_nSamples >= m_sampleLimit) {
+    this->age();
+  }
+}
+
+uint8_t
+FrequencySketch::estimate(size_t key) const
+{
+  if (m_width == 0) {
+    return 0;
+  }
+
+  uint8_t minCount = MAX_COUNT;
+  for (size_t row = 0; row < DEPTH; ++row) {
+    minCount = std::min(minCount, this->getCounter(this->indexOf(key, row)));
+  }
+  return minCount;
+}
+
+void
+FrequencySketch::age()
+{
+  // halve both counters in each octet; the mask drops the bit shifted across nibbles
+  for (uint8_t& pair : m_counters) {
+    pair = (pair >> 1) & 0x77;
+  }
+  m_nSamples /= 2;
+}
+
+const std::string TinyLfuPolicy::POLICY_NAME = "tinylfu";
+NFD_REGISTER_CS_POLICY(TinyLfuPolicy);
+
+constexpr size_t TinyLfuPolicy::WINDOW_PERCENT;
+constexpr size_t TinyLfuPolicy::PROTECTED_PERCENT;
+
+/** \return \p pct percent of \p n, without overflow
+ */
+static size_t
+percentOf(size_t n, size_t pct)
+{
+  return n / 100 * pct + n % 100 * pct / 100;
+}
+
+TinyLfuPolicy::TinyLfuPolicy()
+  : Policy(POLICY_NAME)
+  , m_sizedForLimit(0)
+  , m_windowLimit(1)
+  , m_protectedLimit(0)
+{
+}
+
+void
+TinyLfuPolicy::doAfterInsert(iterator i)
+{
+  m_sketch.increment(name_tree::computeHash(i->getName()));
+  this->attachQueue(i, QUEUE_WINDOW);
+  this->evictEntries();
+}
+
+void
+TinyLfuPolicy::doAfterRefresh(iterator i)
+{
+  this->touch(i);
+}
+
+void
+TinyLfuPolicy::doBeforeErase(iterator i)
+{
+  this->detachQueue(i);
+}
+
+void
+TinyLfuPolicy::doBeforeUse(iterator i)
+{
+  this->touch(i);
+}
+
+void
+TinyLfuPolicy::evictEntries()
+{
+  BOOST_ASSERT(this->getCs() != nullptr);
+  this->updateLimits();
+
+  while (this->isOverLimit()) {
+    this->evictOne();
+  }
+
+  // while CS has room, entries leaving the window enter the main cache without competition
+  Queue& window = m_queues[QUEUE_WINDOW];
+  while (window.size() > m_windowLimit) {
+    this->moveToQueue(window.front(), QUEUE_PROBATION);
+  }
+}
+
+void
+TinyLfuPolicy::doForEachInEvictionOrder(const EntryCallback& f) const
+{
+  // victims are taken from probation first; recently admitted entries in the window are the
+  // last to go, so that reinserting in this order puts them back into the window
+  for (QueueType queueType : {QUEUE_PROBATION, QUEUE_PROTECTED, QUEUE_WINDOW}) {
+    std::for_each(m_queues[queueType].begin(), m_queues[queueType].end(), f);
+  }
+}
+
+void
+TinyLfuPolicy::touch(iterator i)
+{
+  m_sketch.increment(name_tree::computeHash(i->getName()));
+
+  auto it = m_entryInfoMap.find(i);
+  BOOST_ASSERT(it != m_entryInfoMap.end());
+  EntryInfo& entryInfo = it->second;
+  Queue& queue = m_queues[entryInfo.queueType];
+
+  switch (entryInfo.queueType) {
+    case QUEUE_WINDOW:
+    case QUEUE_PROTECTED:
+      queue.splice(queue.end(), queue, entryInfo.queueIt);
+      break;
+    case QUEUE_PROBATION: {
+      Queue& protectedQueue = m_queues[QUEUE_PROTECTED];
+      protectedQueue.splice(protectedQueue.end(), queue, entryInfo.queueIt);
+      entryInfo.queueType = QUEUE_PROTECTED;
+
+      // demote LRU protected entries back to probation
+      while (protectedQueue.size() > m_protectedLimit) {
+        this->moveToQueue(protectedQueue.front(), QUEUE_PROBATION);
+      }
+      break;
+    }
+    default:
+      BOOST_ASSERT(false);
+      break;
+  }
+}
+
+void
+TinyLfuPolicy::attachQueue(iterator i, QueueType queueType)
+{
+  Queue& queue = m_queues[queueType];
+  bool isNew = m_entryInfoMap.emplace(i, EntryInfo{queueType, queue.insert(queue.end(), i)}).second;
+  BOOST_ASSERT(isNew);
+}
+
+void
+TinyLfuPolicy::moveToQueue(iterator i, QueueType queueType)
+{
+  auto it = m_entryInfoMap.find(i);
+  BOOST_ASSERT(it != m_entryInfoMap.end());
+
+  Queue& queue = m_queues[queueType];
+  queue.splice(queue.end(), m_queues[it->second.queueType], it->second.queueIt);
+  it->second.queueType = queueType;
+}
+
+void
+TinyLfuPolicy::detachQueue(iterator i)
+{
+  auto it = m_entryInfoMap.find(i);
+  BOOST_ASSERT(it != m_entryInfoMap.end());
+
+  m_queues[it->second.queueType].erase(it->second.queueIt);
+  m_entryInfoMap.erase(it);
+}
+
+void
+TinyLfuPolicy::evict(iterator i)
+{
+  this->detachQueue(i);
+  this->emitSignal(beforeEvict, i);
+}
+
+void
+TinyLfuPolicy::evictOne()
+{
+  Queue& window = m_queues[QUEUE_WINDOW];
+  Queue& probation = m_queues[QUEUE_PROBATION];
+  Queue& protectedQueue = m_queues[QUEUE_PROTECTED];
+  BOOST_ASSERT(!window.empty() || !probation.empty() || !protectedQueue.empty());
+
+  if (probation.empty() && protectedQueue.empty()) {
+    this->evict(window.front());
+    return;
+  }
+
+  iterator victim = probation.empty() ? protectedQueue.front() : probation.front();
+  if (window.size() <= m_windowLimit) {
+    this->evict(victim);
+    return;
+  }
+
+  // admission: the window's LRU candidate replaces the victim only if it is more popular
+  iterator candidate = window.front();
+  if (this->estimate(candidate) > this->estimate(victim)) {
+    this->evict(victim);
+    this->moveToQueue(candidate, QUEUE_PROBATION);
+  }
+  else {
+    this->evict(candidate);
+  }
+}
+
+uint8_t
+TinyLfuPolicy::estimate(iterator i) const
+{
+  return m_sketch.estimate(name_tree::computeHash(i->getName()));
+}
+
+void
+TinyLfuPolicy::updateLimits()
+{
+  size_t limit = this->getLimit();
+  if (limit == m_sizedForLimit) {
+    return;
+  }
+
+  m_sizedForLimit = limit;
+  m_windowLimit = std::max<size_t>(1, percentOf(limit, WINDOW_PERCENT));
+  size_t mainLimit = limit > m_windowLimit ? limit - m_windowLimit : 0;
+  m_protectedLimit = percentOf(mainLimit, PROTECTED_PERCENT);
+  m_sketch.resize(limit);
+}
+
+} // namespace tinylfu
+} // namespace cs
+} // namespace nfd
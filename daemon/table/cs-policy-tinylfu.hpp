@@ -0,0 +1,222 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_POLICY_TINYLFU_HPP
+#define NFD_DAEMON_TABLE_CS_POLICY_TINYLFU_HPP
+
+#include "cs-policy.hpp"
+
+#include <list>
+
+namespace nfd {
+namespace cs {
+namespace tinylfu {
+
+/** \brief approximately counts how often each key was seen recently
+ *
+ *  This is a count-min sketch with saturating 4-bit counters, packed two per octet.
+ *  After a number of samples proportional to the width, all counters are halved, so that
+ *  the estimate reflects recent popularity rather than all-time popularity.
+ */
+class FrequencySketch : noncopyable
+{
+public:
+  /** \brief resize the sketch to track about \p nKeys keys
+   *  \post all counters are zero
+   */
+  void
+  resize(size_t nKeys);
+
+  /** \brief record an occurrence of \p key
+   */
+  void
+  increment(size_t key);
+
+  /** \return estimated number of recent occurrences of \p key
+   */
+  uint8_t
+  estimate(size_t key) const;
+
+private:
+  size_t
+  indexOf(size_t key, size_t row) const;
+
+  uint8_t
+  getCounter(size_t index) const
+  {
+    return (m_counters[index / 2] >> (index % 2 * 4)) & MAX_COUNT;
+  }
+
+  /** \pre getCounter(index) < MAX_COUNT
+   */
+  void
+  incrementCounter(size_t index)
+  {
+    m_counters[index / 2] += uint8_t(1) << (index % 2 * 4);
+  }
+
+  /** \brief halve all counters
+   */
+  void
+  age();
+
+public:
+  static constexpr size_t DEPTH = 4;
+  static constexpr uint8_t MAX_COUNT = 15;
+
+private:
+  std::vector<uint8_t> m_counters; ///< DEPTH rows of m_width counters, low nibble first
+  size_t m_width = 0; ///< power of two
+  size_t m_nSamples = 0;
+  size_t m_sampleLimit = 0;
+};
+
+enum QueueType {
+  QUEUE_WINDOW,
+  QUEUE_PROBATION,
+  QUEUE_PROTECTED,
+  QUEUE_MAX
+};
+
+typedef std::list<iterator> Queue;
+
+struct EntryInfo
+{
+  QueueType queueType;
+  Queue::iterator queueIt;
+};
+
+struct EntryItHash
+{
+  size_t
+  operator()(const iterator& i) const
+  {
+    return std::hash<const EntryImpl*>()(&*i);
+  }
+};
+
+/** \brief W-TinyLFU cs replacement policy
+ *
+ *  New entries are placed into a small LRU window. Entries leaving the window become
+ *  candidates for the main cache, which is a segmented LRU with a probation and a protected
+ *  segment. When the CS is full, a candidate is admitted into the main cache only if it is
+ *  estimated by a FrequencySketch to be more popular than the main cache's LRU victim;
+ *  otherwise, the candidate is evicted. This keeps a scan of one-time content from
+ *  flushing the popular working set.
+ *
+ *  \sa Einziger, Friedman, Manes, "TinyLFU: A Highly Efficient Cache Admission Policy"
+ */
+class TinyLfuPolicy : public Policy
+{
+public:
+  TinyLfuPolicy();
+
+public:
+  static const std::string POLICY_NAME;
+
+  /// window size, in percent of the limit
+  static constexpr size_t WINDOW_PERCENT = 1;
+  /// protected segment size, in percent of the main cache
+  static constexpr size_t PROTECTED_PERCENT = 80;
+
+private:
+  void
+  doAfterInsert(iterator i) override;
+
+  void
+  doAfterRefresh(iterator i) override;
+
+  void
+  doBeforeErase(iterator i) override;
+
+  void
+  doBeforeUse(iterator i) override;
+
+  void
+  evictEntries() override;
+
+  void
+  doForEachInEvictionOrder(const EntryCallback& f) const override;
+
+private:
+  /** \brief records an access of \p i and moves it toward the protected segment
+   */
+  void
+  touch(iterator i);
+
+  /** \brief appends \p i to the MRU end of \p queueType
+   */
+  void
+  attachQueue(iterator i, QueueType queueType);
+
+  /** \brief moves \p i from its current queue to the MRU end of \p queueType
+   */
+  void
+  moveToQueue(iterator i, QueueType queueType);
+
+  /** \brief removes \p i from its current queue
+   */
+  void
+  detachQueue(iterator i);
+
+  /** \brief evicts \p i
+   */
+  void
+  evict(iterator i);
+
+  /** \brief evicts either the window's LRU candidate or the main cache's LRU victim
+   *  \pre CS is not empty
+   */
+  void
+  evictOne();
+
+  /** \return estimated frequency of \p i
+   */
+  uint8_t
+  estimate(iterator i) const;
+
+  /** \brief recomputes segment sizes and resizes the sketch if the limit has changed
+   */
+  void
+  updateLimits();
+
+private:
+  Queue m_queues[QUEUE_MAX];
+  std::unordered_map<iterator, EntryInfo, EntryItHash> m_entryInfoMap;
+  FrequencySketch m_sketch;
+
+  size_t m_sizedForLimit;
+  size_t m_windowLimit;
+  size_t m_protectedLimit;
+};
+
+} // namespace tinylfu
+
+using tinylfu::TinyLfuPolicy;
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_POLICY_TINYLFU_HPP
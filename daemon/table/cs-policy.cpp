@@ -61,6 +61,7 @@ Policy::getPolicyNames()
 
 Policy::Policy(const std::string& policyName)
   : m_policyName(policyName)
+  , m_byteLimit(std::numeric_limits<size_t>::max())
 {
 }
 
@@ -72,6 +73,21 @@ Policy::setLimit(size_t nMaxEntries)
   this->evictEntries();
 }
 
+void
+Policy::setByteLimit(size_t nMaxBytes)
+{
+  NFD_LOG_INFO("setByteLimit " << nMaxBytes);
+  m_byteLimit = nMaxBytes;
+  this->evictEntries();
+}
+
+bool
+Policy::isOverLimit() const
+{
+  BOOST_ASSERT(m_cs != nullptr);
+  return m_cs->size() > m_limit || m_cs->getBytes() > m_byteLimit;
+}
+
 void
 Policy::afterInsert(iterator i)
 {
@@ -100,5 +116,20 @@ Policy::beforeUse(iterator i)
   this->doBeforeUse(i);
 }
 
+void
+Policy::forEachInEvictionOrder(const EntryCallback& f) const
+{
+  BOOST_ASSERT(m_cs != nullptr);
+  this->doForEachInEvictionOrder(f);
+}
+
+void
+Policy::doForEachInEvictionOrder(const EntryCallback& f) const
+{
+  for (auto it = m_cs->begin(); it != m_cs->end(); ++it) {
+    f(it.base());
+  }
+}
+
 } // namespace cs
 } // namespace nfd
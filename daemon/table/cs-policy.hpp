@@ -94,6 +94,20 @@ public:
   void
   setLimit(size_t nMaxEntries);
 
+  /** \brief gets hard limit (in total wire size of stored Data, in octets)
+   */
+  size_t
+  getByteLimit() const;
+
+  /** \brief sets hard limit (in total wire size of stored Data, in octets)
+   *  \post getByteLimit() == nMaxBytes
+   *  \post cs.getBytes() <= getByteLimit()
+   *
+   *  The policy may evict entries if necessary.
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
   /** \brief emits when an entry is being evicted
    *
    *  A policy implementation should emit this signal to cause CS to erase the entry from its index.
@@ -130,6 +144,16 @@ public:
   void
   beforeUse(iterator i);
 
+  using EntryCallback = std::function<void(iterator)>;
+
+  /** \brief enumerates entries from the first to be evicted to the last
+   *
+   *  Inserting entries into an empty CS in this order approximately rebuilds
+   *  the replacement state, which allows a CS snapshot to be restored.
+   */
+  void
+  forEachInEvictionOrder(const EntryCallback& f) const;
+
 protected:
   /** \brief invoked after a new entry is created in CS
    *
@@ -168,11 +192,24 @@ protected:
   doBeforeUse(iterator i) = 0;
 
   /** \brief evicts zero or more entries
-   *  \post CS size does not exceed hard limit
+   *  \post CS size and total wire size do not exceed hard limits
    */
   virtual void
   evictEntries() = 0;
 
+  /** \brief enumerates entries from the first to be evicted to the last
+   *
+   *  The default implementation enumerates entries in the order of the CS Table.
+   *  A policy implementation should override this with the order of its cleanup index.
+   */
+  virtual void
+  doForEachInEvictionOrder(const EntryCallback& f) const;
+
+  /** \return whether CS size or total wire size exceeds hard limits
+   */
+  bool
+  isOverLimit() const;
+
 protected:
   DECLARE_SIGNAL_EMIT(beforeEvict)
 
@@ -186,6 +223,7 @@ private: // registry
 private:
   std::string m_policyName;
   size_t m_limit;
+  size_t m_byteLimit;
   Cs* m_cs;
 };
 
@@ -213,6 +251,12 @@ Policy::getLimit() const
   return m_limit;
 }
 
+inline size_t
+Policy::getByteLimit() const
+{
+  return m_byteLimit;
+}
+
 } // namespace cs
 } // namespace nfd
 
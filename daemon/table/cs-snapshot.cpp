@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-snapshot.hpp"
+#include "core/logger.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <cstring>
+#include <fstream>
+
+namespace nfd {
+namespace cs {
+
+NFD_LOG_INIT(CsSnapshot);
+
+/** \brief snapshot file format
+ *
+ *  A snapshot file starts with the 8-octet MAGIC, followed by one record per entry,
+ *  in eviction order. Each record consists of a RecordHeader and the Data wire encoding.
+ *  Integers are in host byte order, because a snapshot is read by the same host.
+ */
+static const char MAGIC[8] = {'N', 'F', 'D', 'C', 'S', 'S', '0', '1'};
+
+struct RecordHeader
+{
+  uint32_t length; ///< length of Data wire encoding
+  uint32_t flags;
+  int64_t staleTime; ///< milliseconds since system clock epoch
+};
+
+enum : uint32_t {
+  RECORD_UNSOLICITED = 1 << 0,
+};
+
+size_t
+saveSnapshot(const Cs& cs, const boost::filesystem::path& path)
+{
+  boost::filesystem::path tmpPath = path;
+  tmpPath += ".tmp";
+
+  std::ofstream os(tmpPath.string(), std::ios::binary | std::ios::trunc);
+  if (!os) {
+    BOOST_THROW_EXCEPTION(SnapshotError("Cannot open " + tmpPath.string()));
+  }
+  os.write(MAGIC, sizeof(MAGIC));
+
+  auto now = time::steady_clock::now();
+  auto sysNow = time::system_clock::now();
+  size_t nEntries = 0;
+  cs.getPolicy()->forEachInEvictionOrder([&] (iterator it) {
+    const Block& wire = it->getData().wireEncode();
+    RecordHeader header;
+    header.length = static_cast<uint32_t>(wire.size());
+    header.flags = it->isUnsolicited() ? RECORD_UNSOLICITED : 0;
+    header.staleTime = time::toUnixTimestamp(sysNow + (it->getStaleTime() - now)).count();
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char*>(wire.wire()), wire.size());
+    ++nEntries;
+  });
+
+  os.close();
+  if (!os) {
+    BOOST_THROW_EXCEPTION(SnapshotError("Cannot write " + tmpPath.string()));
+  }
+
+  boost::system::error_code ec;
+  boost::filesystem::rename(tmpPath, path, ec);
+  if (ec) {
+    BOOST_THROW_EXCEPTION(SnapshotError("Cannot rename " + tmpPath.string() + ": " + ec.message()));
+  }
+
+  NFD_LOG_INFO("Saved " << nEntries << " entries to " << path);
+  return nEntries;
+}
+
+size_t
+loadSnapshot(Cs& cs, const boost::filesystem::path& path)
+{
+  std::ifstream is(path.string(), std::ios::binary);
+  if (!is) {
+    BOOST_THROW_EXCEPTION(SnapshotError("Cannot open " + path.string()));
+  }
+
+  char magic[sizeof(MAGIC)];
+  if (!is.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+    BOOST_THROW_EXCEPTION(SnapshotError(path.string() + " is not a CS snapshot"));
+  }
+
+  auto now = time::steady_clock::now();
+  auto sysNow = time::system_clock::now();
+  std::vector<Cs::BulkEntry> entries;
+  RecordHeader header;
+  while (is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    if (header.length > ndn::MAX_NDN_PACKET_SIZE) {
+      BOOST_THROW_EXCEPTION(SnapshotError(path.string() + " contains oversized record of " +
+                                          to_string(header.length) + " octets"));
+    }
+    auto buffer = make_shared<ndn::Buffer>(header.length);
+    if (!is.read(reinterpret_cast<char*>(buffer->data()), header.length)) {
+      BOOST_THROW_EXCEPTION(SnapshotError(path.string() + " is truncated"));
+    }
+
+    shared_ptr<Data> data;
+    try {
+      data = make_shared<Data>(Block(buffer));
+    }
+    catch (const tlv::Error& e) {
+      BOOST_THROW_EXCEPTION(SnapshotError(path.string() + " contains malformed Data: " + e.what()));
+    }
+
+    auto staleTime = time::fromUnixTimestamp(time::milliseconds(header.staleTime));
+    entries.push_back({std::move(data), (header.flags & RECORD_UNSOLICITED) != 0,
+                       now + (staleTime - sysNow)});
+  }
+  if (is.gcount() != 0) {
+    BOOST_THROW_EXCEPTION(SnapshotError(path.string() + " is truncated"));
+  }
+
+  size_t nInserted = cs.bulkInsert(std::move(entries));
+  NFD_LOG_INFO("Loaded " << nInserted << " entries from " << path);
+  return nInserted;
+}
+
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,69 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_SNAPSHOT_HPP
+#define NFD_DAEMON_TABLE_CS_SNAPSHOT_HPP
+
+#include "cs.hpp"
+
+#include <boost/filesystem/path.hpp>
+
+namespace nfd {
+namespace cs {
+
+/** \brief indicates a snapshot file cannot be written or read
+ */
+class SnapshotError : public std::runtime_error
+{
+public:
+  using std::runtime_error::runtime_error;
+};
+
+/** \brief writes Data packets stored in \p cs to a snapshot file
+ *
+ *  Entries are written in the eviction order of the replacement policy, so that loading
+ *  the snapshot approximately restores the replacement state. Each record carries the
+ *  time when the Data becomes stale, in system clock, so that freshness is preserved
+ *  across restarts. The file is written under a temporary name and then renamed,
+ *  so that an existing snapshot is replaced atomically.
+ *
+ *  \return number of written entries
+ *  \throw SnapshotError the file cannot be written
+ */
+size_t
+saveSnapshot(const Cs& cs, const boost::filesystem::path& path);
+
+/** \brief inserts Data packets from a snapshot file into \p cs
+ *  \return number of inserted entries
+ *  \throw SnapshotError the file cannot be read or is malformed
+ *  \sa Cs::bulkInsert
+ */
+size_t
+loadSnapshot(Cs& cs, const boost::filesystem::path& path);
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_SNAPSHOT_HPP
@@ -37,6 +37,23 @@ NDN_CXX_ASSERT_FORWARD_ITERATOR(Cs::const_iterator);
 
 NFD_LOG_INIT(ContentStore);
 
+constexpr size_t Cs::ERASE_JOB_BATCH;
+constexpr uint64_t Cs::MISS_FILTER_VERIFY_INTERVAL;
+
+static bool
+endsWithImplicitDigest(const Name& name)
+{
+  return !name.empty() && name[-1].isImplicitSha256Digest();
+}
+
+/** \return whether the Name of \p entry equals the first \p prefixLen components of \p name
+ */
+static bool
+isSameName(const EntryImpl& entry, const Name& name, size_t prefixLen)
+{
+  return entry.getName().size() == prefixLen && name.compare(0, prefixLen, entry.getName()) == 0;
+}
+
 static unique_ptr<Policy>
 makeDefaultPolicy()
 {
@@ -44,17 +61,31 @@ makeDefaultPolicy()
 }
 
 Cs::Cs(size_t nMaxPackets)
-  : m_shouldAdmit(true)
+  : m_nBytes(0)
+  , m_nMissFilterHits(0)
+  , m_nMissFilterFalsePositives(0)
+  , m_shouldAdmit(true)
   , m_shouldServe(true)
 {
   this->setPolicyImpl(makeDefaultPolicy());
   m_policy->setLimit(nMaxPackets);
 }
 
+Cs::~Cs()
+{
+  for (auto& job : m_eraseJobs) {
+    scheduler::cancel(job.second.nextBatch);
+  }
+}
+
 void
 Cs::insert(const Data& data, bool isUnsolicited)
 {
-  if (!m_shouldAdmit || m_policy->getLimit() == 0) {
+  if (m_policy->getLimit() == 0) {
+    return;
+  }
+  if (!m_shouldAdmit || data.wireEncode().size() > m_policy->getByteLimit()) {
+    this->addToMissFilter(data.getName());
     return;
   }
   NFD_LOG_DEBUG("insert " << data.getName());
@@ -64,16 +95,29 @@ Cs::insert(const Data& data, bool isUnsolicited)
   if (tag != nullptr) {
     lp::CachePolicyType policy = tag->get().getPolicy();
     if (policy == lp::CachePolicyType::NO_CACHE) {
+      this->addToMissFilter(data.getName());
       return;
     }
   }
 
+  this->insertImpl(data, isUnsolicited);
+}
+
+void
+Cs::insertImpl(const Data& data, bool isUnsolicited,
+               optional<time::steady_clock::TimePoint> staleTime)
+{
   iterator it;
   bool isNewEntry = false;
   std::tie(it, isNewEntry) = m_table.emplace(data.shared_from_this(), isUnsolicited);
   EntryImpl& entry = const_cast<EntryImpl&>(*it);
 
-  entry.updateStaleTime();
+  if (staleTime) {
+    entry.setStaleTime(*staleTime);
+  }
+  else {
+    entry.updateStaleTime();
+  }
 
   if (!isNewEntry) { // existing entry
     // XXX This doesn't forbid unsolicited Data from refreshing a solicited entry.
@@ -84,10 +128,65 @@ Cs::insert(const Data& data, bool isUnsolicited)
     m_policy->afterRefresh(it);
   }
   else {
+    if (!m_missFilter.empty() && m_missFilter.containsAny(name_tree::computeHashes(entry.getName()))) {
+      NFD_LOG_DEBUG("miss-filter-clear " << entry.getName());
+      m_missFilter.clear();
+    }
+    this->indexInsert(it);
+    m_nBytes += entry.getData().wireEncode().size();
     m_policy->afterInsert(it);
   }
 }
 
+size_t
+Cs::bulkInsert(std::vector<BulkEntry> entries)
+{
+  // entries at the front would be evicted immediately
+  size_t limit = m_policy->getLimit();
+  if (entries.size() > limit) {
+    entries.erase(entries.begin(), entries.end() - limit);
+  }
+
+  // sort by Table order, remembering the position in eviction order
+  std::vector<std::pair<EntryImpl, size_t>> sorted;
+  sorted.reserve(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    sorted.emplace_back(EntryImpl(std::move(entries[i].data), entries[i].isUnsolicited), i);
+    sorted.back().first.setStaleTime(entries[i].staleTime);
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [] (const auto& a, const auto& b) { return a.first < b.first; });
+
+  // each entry is inserted right after its predecessor, in amortized constant time
+  std::vector<optional<iterator>> inserted(sorted.size());
+  iterator hint = m_table.end();
+  for (auto& p : sorted) {
+    size_t nBefore = m_table.size();
+    iterator it = m_table.emplace_hint(hint, std::move(p.first));
+    hint = std::next(it);
+    if (m_table.size() > nBefore) {
+      inserted[p.second] = it;
+    }
+  }
+  NFD_LOG_DEBUG("bulk-insert " << entries.size() << " entries");
+
+  if (!m_missFilter.empty()) {
+    m_missFilter.clear();
+  }
+
+  size_t nInserted = 0;
+  for (const auto& it : inserted) {
+    if (!it) { // duplicate
+      continue;
+    }
+    this->indexInsert(*it);
+    m_nBytes += (*it)->getData().wireEncode().size();
+    m_policy->afterInsert(*it);
+    ++nInserted;
+  }
+  return nInserted;
+}
+
 void
 Cs::erase(const Name& prefix, size_t limit, const AfterEraseCallback& cb)
 {
@@ -100,21 +199,94 @@ Cs::erase(const Name& prefix, size_t limit, const AfterEraseCallback& cb)
   }
 
   size_t nErased = 0;
+  if (endsWithImplicitDigest(prefix) && limit > 0) {
+    // an entry whose full name equals prefix sorts by its Name, outside [first,last)
+    for (iterator it = this->findNameRun(prefix, prefix.size() - 1);
+         it != m_table.end() && isSameName(*it, prefix, prefix.size() - 1); ++it) {
+      if (it->getFullName()[-1] == prefix[-1]) {
+        m_policy->beforeErase(it);
+        this->eraseImpl(it);
+        ++nErased;
+        break;
+      }
+    }
+  }
+
   while (first != last && nErased < limit) {
     m_policy->beforeErase(first);
-    first = m_table.erase(first);
+    first = this->eraseImpl(first);
     ++nErased;
   }
 
+  if (m_diskTier != nullptr && nErased < limit) {
+    nErased += m_diskTier->erase(prefix, limit - nErased);
+  }
+
   if (cb) {
     cb(nErased);
   }
 }
 
+void
+Cs::startEraseJob(const Name& prefix, const AfterEraseCallback& cb)
+{
+  bool isNew = false;
+  std::map<Name, EraseJob>::iterator it;
+  std::tie(it, isNew) = m_eraseJobs.emplace(prefix, EraseJob());
+  it->second.afterDone = cb;
+  if (!isNew) {
+    return;
+  }
+
+  NFD_LOG_DEBUG("erase-job-start " << prefix);
+  it->second.nextBatch = scheduler::schedule(0_ns, [this, prefix] { this->runEraseJob(prefix); });
+}
+
+optional<size_t>
+Cs::cancelEraseJob(const Name& prefix)
+{
+  auto it = m_eraseJobs.find(prefix);
+  if (it == m_eraseJobs.end()) {
+    return nullopt;
+  }
+
+  size_t nErased = it->second.nErased;
+  NFD_LOG_DEBUG("erase-job-cancel " << prefix << " erased=" << nErased);
+  scheduler::cancel(it->second.nextBatch);
+  m_eraseJobs.erase(it);
+  return nErased;
+}
+
+void
+Cs::runEraseJob(const Name& prefix)
+{
+  auto it = m_eraseJobs.find(prefix);
+  BOOST_ASSERT(it != m_eraseJobs.end());
+  EraseJob& job = it->second;
+
+  size_t nErased = 0;
+  this->erase(prefix, ERASE_JOB_BATCH, [&nErased] (size_t n) { nErased = n; });
+  job.nErased += nErased;
+
+  if (nErased == ERASE_JOB_BATCH) {
+    NFD_LOG_TRACE("erase-job-progress " << prefix << " erased=" << job.nErased);
+    job.nextBatch = scheduler::schedule(0_ns, [this, prefix] { this->runEraseJob(prefix); });
+    return;
+  }
+
+  NFD_LOG_DEBUG("erase-job-done " << prefix << " erased=" << job.nErased);
+  AfterEraseCallback afterDone = std::move(job.afterDone);
+  nErased = job.nErased;
+  m_eraseJobs.erase(it);
+  if (afterDone) {
+    afterDone(nErased);
+  }
+}
+
 void
 Cs::find(const Interest& interest,
          const HitCallback& hitCallback,
-         const MissCallback& missCallback) const
+         const MissCallback& missCallback)
 {
   BOOST_ASSERT(static_cast<bool>(hitCallback));
   BOOST_ASSERT(static_cast<bool>(missCallback));
@@ -127,30 +299,142 @@ Cs::find(const Interest& interest,
   bool isRightmost = interest.getChildSelector() == 1;
   NFD_LOG_DEBUG("find " << prefix << (isRightmost ? " R" : " L"));
 
-  iterator first = m_table.lower_bound(prefix);
-  iterator last = m_table.end();
-  if (prefix.size() > 0) {
-    last = m_table.lower_bound(prefix.getSuccessor());
+  bool isFilteredMiss = !m_missFilter.empty() && !endsWithImplicitDigest(prefix) &&
+                        m_missFilter.contains(name_tree::computeHash(prefix));
+  if (isFilteredMiss) {
+    ++m_nMissFilterHits;
+    if (m_nMissFilterHits % MISS_FILTER_VERIFY_INTERVAL != 0) {
+      NFD_LOG_DEBUG("  filtered-miss");
+      missCallback(interest);
+      return;
+    }
   }
 
-  iterator match = last;
-  if (isRightmost) {
-    match = this->findRightmost(interest, first, last);
+  iterator match = m_table.end();
+  if (!interest.getCanBePrefix()) {
+    match = this->findExact(interest, isRightmost);
   }
   else {
-    match = this->findLeftmost(interest, first, last);
+    // Data whose full Name equals an Interest Name ending with an implicit digest is ordered
+    // by its own Name, ahead of the range below; it is the leftmost match under that Interest
+    bool hasDigest = endsWithImplicitDigest(prefix);
+    if (hasDigest && !isRightmost) {
+      match = this->findExactByName(interest, prefix.size() - 1);
+    }
+
+    if (match == m_table.end()) {
+      iterator first = m_table.lower_bound(prefix);
+      iterator last = m_table.end();
+      if (prefix.size() > 0) {
+        last = m_table.lower_bound(prefix.getSuccessor());
+      }
+
+      if (isRightmost) {
+        match = this->findRightmost(interest, first, last);
+      }
+      else {
+        match = this->findLeftmost(interest, first, last);
+      }
+      if (match == last) {
+        match = m_table.end();
+      }
+    }
+
+    if (match == m_table.end() && hasDigest && isRightmost) {
+      match = this->findExactByName(interest, prefix.size() - 1);
+    }
   }
 
-  if (match == last) {
+  if (match != m_table.end() && isFilteredMiss) {
+    NFD_LOG_DEBUG("  miss-filter-false-positive");
+    ++m_nMissFilterFalsePositives;
+    m_missFilter.clear();
+  }
+
+  if (match == m_table.end()) {
+    shared_ptr<const Data> promoted = this->findOnDisk(interest);
+    if (promoted != nullptr) {
+      hitCallback(interest, *promoted);
+      return;
+    }
+    if (m_asyncLookup) {
+      NFD_LOG_DEBUG("  async-lookup");
+      m_asyncLookup(interest,
+        [this, hitCallback] (const Interest& interest, const Data& data) {
+          this->insert(data);
+          hitCallback(interest, data);
+        },
+        missCallback);
+      return;
+    }
     NFD_LOG_DEBUG("  no-match");
     missCallback(interest);
     return;
   }
+  // only findRightmostAmongExact picks the rightmost of several same-Name entries;
+  // a sub-namespace found by findRightmost is searched leftmost
+  match = this->findAmongSameName(interest, match,
+                                  isRightmost && match->getName().size() == prefix.size());
   NFD_LOG_DEBUG("  matching " << match->getName());
   m_policy->beforeUse(match);
   hitCallback(interest, match->getData());
 }
 
+void
+Cs::addToMissFilter(const Name& name)
+{
+  if (m_diskTier != nullptr || m_asyncLookup) {
+    return;
+  }
+
+  // Data under this Name may have been admitted earlier
+  iterator it = m_table.lower_bound(name);
+  if (it != m_table.end() && name.isPrefixOf(it->getName())) {
+    return;
+  }
+
+  m_missFilter.add(name_tree::computeHash(name));
+}
+
+shared_ptr<const Data>
+Cs::findOnDisk(const Interest& interest)
+{
+  if (m_diskTier == nullptr) {
+    return nullptr;
+  }
+
+  time::system_clock::TimePoint staleTime;
+  shared_ptr<Data> data = m_diskTier->find(interest, staleTime);
+  if (data == nullptr) {
+    return nullptr;
+  }
+  NFD_LOG_DEBUG("  matching-on-disk " << data->getName());
+
+  if (m_shouldAdmit && data->wireEncode().size() <= m_policy->getByteLimit()) {
+    // the entry may be evicted again by the policy, but the Data outlives it through shared_ptr
+    this->insertImpl(*data, false,
+                     time::steady_clock::now() + (staleTime - time::system_clock::now()));
+  }
+  return data;
+}
+
+void
+Cs::demote(iterator it)
+{
+  if (m_diskTier == nullptr) {
+    return;
+  }
+
+  NFD_LOG_TRACE("demote " << it->getName());
+  try {
+    m_diskTier->insert(it->getData(),
+                       time::system_clock::now() + (it->getStaleTime() - time::steady_clock::now()));
+  }
+  catch (const DiskTier::Error& e) {
+    NFD_LOG_WARN("demote " << it->getName() << " failed: " << e.what());
+  }
+}
+
 iterator
 Cs::findLeftmost(const Interest& interest, iterator first, iterator last) const
 {
@@ -195,6 +479,127 @@ Cs::findRightmostAmongExact(const Interest& interest, iterator first, iterator l
   return find_last_if(first, last, [&interest] (const auto& entry) { return entry.canSatisfy(interest); });
 }
 
+iterator
+Cs::findExact(const Interest& interest, bool isRightmost) const
+{
+  const Name& name = interest.getName();
+  if (!endsWithImplicitDigest(name)) {
+    return this->findExactByName(interest, name.size());
+  }
+
+  // Interest Name is either a Data full name, or a Data Name ending with a digest component;
+  // entries in the former case sort before those in the latter case
+  size_t firstLen = isRightmost ? name.size() : name.size() - 1;
+  size_t secondLen = isRightmost ? name.size() - 1 : name.size();
+  iterator match = this->findExactByName(interest, firstLen);
+  if (match != m_table.end()) {
+    return match;
+  }
+  return this->findExactByName(interest, secondLen);
+}
+
+iterator
+Cs::findExactByName(const Interest& interest, size_t prefixLen) const
+{
+  const Name& name = interest.getName();
+  for (iterator it = this->findNameRun(name, prefixLen);
+       it != m_table.end() && isSameName(*it, name, prefixLen); ++it) {
+    if (it->canSatisfy(interest)) {
+      return it;
+    }
+  }
+  return m_table.end();
+}
+
+iterator
+Cs::findNameRun(const Name& name, size_t prefixLen) const
+{
+  auto range = m_exactIndex.equal_range(name_tree::computeHash(name, prefixLen));
+  for (auto i = range.first; i != range.second; ++i) {
+    if (isSameName(*i->second, name, prefixLen)) {
+      return i->second;
+    }
+  }
+  return m_table.end();
+}
+
+iterator
+Cs::findAmongSameName(const Interest& interest, iterator match, bool isRightmost) const
+{
+  // entries with the same Name are adjacent in the Table, but they are not ordered by
+  // implicit digest; digests are computed only if there are several such entries
+  const Name& name = match->getName();
+  iterator first = match;
+  while (first != m_table.begin() && std::prev(first)->getName() == name) {
+    --first;
+  }
+  iterator last = std::next(match);
+  while (last != m_table.end() && last->getName() == name) {
+    ++last;
+  }
+  if (std::next(first) == last) {
+    return match;
+  }
+
+  for (iterator it = first; it != last; ++it) {
+    if (it == match || !it->canSatisfy(interest)) {
+      continue;
+    }
+    int cmp = it->getFullName()[-1].compare(match->getFullName()[-1]);
+    if (isRightmost ? cmp > 0 : cmp < 0) {
+      match = it;
+    }
+  }
+  return match;
+}
+
+iterator
+Cs::eraseImpl(iterator it)
+{
+  this->indexErase(it);
+  BOOST_ASSERT(m_nBytes >= it->getData().wireEncode().size());
+  m_nBytes -= it->getData().wireEncode().size();
+  return m_table.erase(it);
+}
+
+void
+Cs::indexInsert(iterator it)
+{
+  const Name& name = it->getName();
+  if (it != m_table.begin() && std::prev(it)->getName() == name) {
+    return; // not the leftmost entry with this Name
+  }
+
+  name_tree::HashValue h = name_tree::computeHash(name);
+  auto range = m_exactIndex.equal_range(h);
+  for (auto i = range.first; i != range.second; ++i) {
+    if (i->second->getName() == name) {
+      i->second = it; // new entry is inserted before the previous leftmost entry
+      return;
+    }
+  }
+  m_exactIndex.emplace(h, it);
+}
+
+void
+Cs::indexErase(iterator it)
+{
+  const Name& name = it->getName();
+  auto range = m_exactIndex.equal_range(name_tree::computeHash(name));
+  for (auto i = range.first; i != range.second; ++i) {
+    if (i->second == it) {
+      iterator next = std::next(it);
+      if (next != m_table.end() && next->getName() == name) {
+        i->second = next;
+      }
+      else {
+        m_exactIndex.erase(i);
+      }
+      return;
+    }
+  }
+}
+
 void
 Cs::dump()
 {
@@ -210,8 +615,10 @@ Cs::setPolicy(unique_ptr<Policy> policy)
   BOOST_ASSERT(policy != nullptr);
   BOOST_ASSERT(m_policy != nullptr);
   size_t limit = m_policy->getLimit();
+  size_t byteLimit = m_policy->getByteLimit();
   this->setPolicyImpl(std::move(policy));
   m_policy->setLimit(limit);
+  m_policy->setByteLimit(byteLimit);
 }
 
 void
@@ -220,7 +627,8 @@ Cs::setPolicyImpl(unique_ptr<Policy> policy)
   NFD_LOG_DEBUG("set-policy " << policy->getName());
   m_policy = std::move(policy);
   m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (iterator it) {
-      m_table.erase(it);
+      this->demote(it);
+      this->eraseImpl(it);
     });
 
   m_policy->setCs(this);
@@ -247,5 +655,27 @@ Cs::enableServe(bool shouldServe)
   NFD_LOG_INFO((shouldServe ? "Enabling" : "Disabling") << " Data serving");
 }
 
+void
+Cs::setAsyncLookup(const AsyncLookup& asyncLookup)
+{
+  m_asyncLookup = asyncLookup;
+  if (m_asyncLookup) {
+    m_missFilter.clear();
+  }
+}
+
+void
+Cs::setDiskTier(unique_ptr<DiskTier> diskTier)
+{
+  m_diskTier = std::move(diskTier);
+  if (m_diskTier != nullptr) {
+    m_missFilter.clear();
+    NFD_LOG_INFO("Enabling disk tier " << m_diskTier->getPath());
+  }
+  else {
+    NFD_LOG_INFO("Disabling disk tier");
+  }
+}
+
 } // namespace cs
 } // namespace nfd
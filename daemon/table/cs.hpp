@@ -29,6 +29,10 @@
 #include "cs-policy.hpp"
 #include "cs-internal.hpp"
 #include "cs-entry-impl.hpp"
+#include "cs-disk-tier.hpp"
+#include "cs-miss-filter.hpp"
+#include "name-tree-hashtable.hpp"
+#include "core/scheduler.hpp"
 #include <ndn-cxx/util/signal.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 
@@ -39,11 +43,30 @@ namespace cs {
  *
  *  This Content Store implementation consists of a Table and a replacement policy.
  *
- *  The Table is a container ( \c std::set ) sorted by full Names of stored Data packets.
+ *  The Table is a container ( \c std::set ) sorted by Names of stored Data packets.
+ *  Data packets with the same Name are ordered by their wire encodings, so that
+ *  implicit digests are computed only when an Interest needs them.
  *  Data packets are wrapped in Entry objects. Each Entry contains the Data packet itself,
  *  and a few additional attributes such as when the Data becomes non-fresh.
  *
+ *  An exact-match index maps the hash of each distinct Data Name to the leftmost Table entry
+ *  with that Name. It serves Interests with CanBePrefix=false in one hash probe,
+ *  while the Table serves prefix queries.
+ *
  *  The replacement policy is implemented in a subclass of \c Policy.
+ *
+ *  An optional DiskTier acts as a second tier: entries evicted by the replacement policy
+ *  are demoted to the DiskTier, and a lookup that misses in memory is retried on the DiskTier,
+ *  promoting the found Data back into memory. Demotion writes to the DiskTier synchronously
+ *  during eviction; if the write fails, such as when the filesystem is full, the evicted
+ *  Data is dropped.
+ *
+ *  A MissFilter remembers Names of Data that were refused admission, such as Data carrying
+ *  a NO_CACHE CachePolicy or arriving while admission is disabled. Lookups for those Names
+ *  miss without searching the Table. The filter is cleared whenever a Data under a remembered
+ *  Name is inserted. Every MISS_FILTER_VERIFY_INTERVAL-th filtered lookup still searches
+ *  the Table, in order to measure false positives. The MissFilter is not used while the
+ *  DiskTier or an AsyncLookup is enabled.
  */
 class Cs : noncopyable
 {
@@ -51,11 +74,33 @@ public:
   explicit
   Cs(size_t nMaxPackets = 10);
 
+  ~Cs();
+
   /** \brief inserts a Data packet
    */
   void
   insert(const Data& data, bool isUnsolicited = false);
 
+  /** \brief an entry to be inserted by bulkInsert
+   */
+  struct BulkEntry
+  {
+    shared_ptr<const Data> data;
+    bool isUnsolicited;
+    time::steady_clock::TimePoint staleTime;
+  };
+
+  /** \brief inserts many Data packets at once, such as when restoring a snapshot
+   *  \param entries entries ordered from the first to be evicted to the last
+   *
+   *  Entries are inserted into the Table in sorted order, and then passed to the
+   *  replacement policy in the given order. If there are more entries than the capacity,
+   *  only the last entries are inserted. Admission checks are not applied.
+   *  \return number of inserted entries
+   */
+  size_t
+  bulkInsert(std::vector<BulkEntry> entries);
+
   using AfterEraseCallback = std::function<void(size_t nErased)>;
 
   /** \brief asynchronously erases entries under \p prefix
@@ -67,10 +112,50 @@ public:
   void
   erase(const Name& prefix, size_t limit, const AfterEraseCallback& cb);
 
+  /** \brief starts a background job that erases all entries under \p prefix
+   *
+   *  The job erases at most ERASE_JOB_BATCH entries per turn of the event loop,
+   *  so that erasing a large namespace does not stall forwarding.
+   *  If a job for \p prefix is already running, it continues, and \p cb replaces its callback.
+   *  \param cb callback to receive the total number of erased entries when the job completes;
+   *            it may be empty; it is not invoked if the job is cancelled
+   */
+  void
+  startEraseJob(const Name& prefix, const AfterEraseCallback& cb = nullptr);
+
+  /** \brief cancels the background erase job for \p prefix
+   *  \return number of entries erased by the job, or nullopt if there is no such job
+   */
+  optional<size_t>
+  cancelEraseJob(const Name& prefix);
+
+  /** \brief a background erase job
+   */
+  struct EraseJob
+  {
+    size_t nErased = 0; ///< number of entries erased so far
+    AfterEraseCallback afterDone;
+    scheduler::EventId nextBatch;
+  };
+
+  /** \return running background erase jobs, indexed by prefix
+   */
+  const std::map<Name, EraseJob>&
+  getEraseJobs() const
+  {
+    return m_eraseJobs;
+  }
+
+  /// max number of entries erased by a background erase job per turn of the event loop
+  static constexpr size_t ERASE_JOB_BATCH = 256;
+
   using HitCallback = std::function<void(const Interest&, const Data&)>;
   using MissCallback = std::function<void(const Interest&)>;
 
   /** \brief finds the best matching Data packet
+   *
+   *  If the lookup misses in memory and on the DiskTier, it is passed to the AsyncLookup,
+   *  if one is set, which may complete after find() returns.
    *  \param interest the Interest for lookup
    *  \param hitCallback a callback if a match is found; must not be empty
    *  \param missCallback a callback if there's no match; must not be empty
@@ -80,7 +165,7 @@ public:
   void
   find(const Interest& interest,
        const HitCallback& hitCallback,
-       const MissCallback& missCallback) const;
+       const MissCallback& missCallback);
 
   /** \brief get number of stored packets
    */
@@ -90,6 +175,34 @@ public:
     return m_table.size();
   }
 
+  /** \brief get total wire size of stored packets, in octets
+   */
+  size_t
+  getBytes() const
+  {
+    return m_nBytes;
+  }
+
+public: // miss filter
+  /** \return number of lookups answered as misses by the MissFilter
+   */
+  uint64_t
+  getNMissFilterHits() const
+  {
+    return m_nMissFilterHits;
+  }
+
+  /** \return number of verified MissFilter hits that found a match in the Table
+   */
+  uint64_t
+  getNMissFilterFalsePositives() const
+  {
+    return m_nMissFilterFalsePositives;
+  }
+
+  /// every this many MissFilter hits, the lookup is performed anyway to detect false positives
+  static constexpr uint64_t MISS_FILTER_VERIFY_INTERVAL = 64;
+
 public: // configuration
   /** \brief get capacity (in number of packets)
    */
@@ -107,6 +220,23 @@ public: // configuration
     return m_policy->setLimit(nMaxPackets);
   }
 
+  /** \brief get capacity (in total wire size of stored packets, in octets)
+   */
+  size_t
+  getByteLimit() const
+  {
+    return m_policy->getByteLimit();
+  }
+
+  /** \brief change capacity (in total wire size of stored packets, in octets)
+   *  \note A Data packet larger than this limit is never admitted.
+   */
+  void
+  setByteLimit(size_t nMaxBytes)
+  {
+    return m_policy->setByteLimit(nMaxBytes);
+  }
+
   /** \brief get replacement policy
    */
   Policy*
@@ -151,6 +281,55 @@ public: // configuration
   void
   enableServe(bool shouldServe);
 
+  /** \brief an external lookup consulted when a lookup misses in memory and on the DiskTier
+   *
+   *  It may invoke either callback after it returns, e.g. after querying another process.
+   *  It must not invoke callbacks after the Cs is destroyed or the AsyncLookup is replaced.
+   *  Data found by an AsyncLookup is inserted into memory before \p hitCallback of find(),
+   *  so it must be owned by a shared_ptr.
+   */
+  using AsyncLookup = std::function<void(const Interest&, const HitCallback&, const MissCallback&)>;
+
+  /** \brief change AsyncLookup
+   *  \param asyncLookup the external lookup, or empty to disable
+   */
+  void
+  setAsyncLookup(const AsyncLookup& asyncLookup);
+
+  /** \brief get disk tier
+   *  \return the disk tier, or nullptr if disabled
+   */
+  DiskTier*
+  getDiskTier() const
+  {
+    return m_diskTier.get();
+  }
+
+  /** \brief change disk tier
+   *  \param diskTier the disk tier, or nullptr to disable
+   */
+  void
+  setDiskTier(unique_ptr<DiskTier> diskTier);
+
+  /** \brief get snapshot file path
+   *  \return the path, or empty if snapshots are disabled
+   *  \sa saveSnapshot
+   */
+  const boost::filesystem::path&
+  getSnapshotPath() const
+  {
+    return m_snapshotPath;
+  }
+
+  /** \brief change snapshot file path
+   *  \param path the path, or empty to disable snapshots
+   */
+  void
+  setSnapshotPath(const boost::filesystem::path& path)
+  {
+    m_snapshotPath = path;
+  }
+
 public: // enumeration
   struct EntryFromEntryImpl
   {
@@ -179,6 +358,36 @@ public: // enumeration
     return boost::make_transform_iterator(m_table.end(), EntryFromEntryImpl());
   }
 
+private: // erase
+  /** \brief erases a batch of entries for the background erase job of \p prefix
+   */
+  void
+  runEraseJob(const Name& prefix);
+
+private: // insert
+  /** \brief inserts a Data packet
+   *  \param staleTime stale time of the entry; if nullopt, it is computed from FreshnessPeriod
+   */
+  void
+  insertImpl(const Data& data, bool isUnsolicited,
+             optional<time::steady_clock::TimePoint> staleTime = nullopt);
+
+  /** \brief remembers that Data under \p name is absent, after it is refused admission
+   */
+  void
+  addToMissFilter(const Name& name);
+
+  /** \brief retries a lookup that missed in memory on the disk tier
+   *  \return the Data promoted into memory, or nullptr if not found
+   */
+  shared_ptr<const Data>
+  findOnDisk(const Interest& interest);
+
+  /** \brief moves an entry being evicted to the disk tier
+   */
+  void
+  demote(iterator it);
+
 private: // find
   /** \brief find leftmost match in [first,last)
    *  \return the leftmost match, or last if not found
@@ -198,6 +407,51 @@ private: // find
   iterator
   findRightmostAmongExact(const Interest& interest, iterator first, iterator last) const;
 
+  /** \brief find a match for an Interest that cannot match by prefix, using the exact-match index
+   *
+   *  This is used for Interests with CanBePrefix=false, and Interests whose Name ends with
+   *  an implicit digest component.
+   *  \return the match, or m_table.end() if not found
+   */
+  iterator
+  findExact(const Interest& interest, bool isRightmost) const;
+
+  /** \brief find leftmost match among entries whose Name equals the first \p prefixLen
+   *         components of Interest Name
+   *  \return the match, or m_table.end() if not found
+   */
+  iterator
+  findExactByName(const Interest& interest, size_t prefixLen) const;
+
+  /** \brief find leftmost entry whose Name equals the first \p prefixLen components of \p name
+   *  \return the entry, or m_table.end() if not found
+   */
+  iterator
+  findNameRun(const Name& name, size_t prefixLen) const;
+
+  /** \brief among matches with the same Name as \p match, find the one with the
+   *         smallest (or largest if \p isRightmost) implicit digest
+   *  \pre match->canSatisfy(interest)
+   */
+  iterator
+  findAmongSameName(const Interest& interest, iterator match, bool isRightmost) const;
+
+  /** \brief erase \p it from the Table and the exact-match index
+   *  \return iterator following the erased entry
+   */
+  iterator
+  eraseImpl(iterator it);
+
+  /** \brief update the exact-match index after \p it is inserted into the Table
+   */
+  void
+  indexInsert(iterator it);
+
+  /** \brief update the exact-match index before \p it is erased from the Table
+   */
+  void
+  indexErase(iterator it);
+
   void
   setPolicyImpl(unique_ptr<Policy> policy);
 
@@ -207,8 +461,18 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
 private:
   Table m_table;
+  /// exact-match index: hash of Data Name => leftmost Table entry with that Name
+  std::unordered_multimap<name_tree::HashValue, iterator> m_exactIndex;
+  size_t m_nBytes; ///< total wire size of stored packets
   unique_ptr<Policy> m_policy;
   signal::ScopedConnection m_beforeEvictConnection;
+  unique_ptr<DiskTier> m_diskTier;
+  AsyncLookup m_asyncLookup;
+  boost::filesystem::path m_snapshotPath;
+  std::map<Name, EraseJob> m_eraseJobs;
+  MissFilter m_missFilter;
+  uint64_t m_nMissFilterHits;
+  uint64_t m_nMissFilterFalsePositives;
 
   bool m_shouldAdmit; ///< if false, no Data will be admitted
   bool m_shouldServe; ///< if false, all lookups will miss
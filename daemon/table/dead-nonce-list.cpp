@@ -37,15 +37,27 @@ const size_t DeadNonceList::INITIAL_CAPACITY = (1 << 7);
 const size_t DeadNonceList::MIN_CAPACITY = (1 << 3);
 const size_t DeadNonceList::MAX_CAPACITY = (1 << 24);
 const DeadNonceList::Entry DeadNonceList::MARK = 0;
+const DeadNonceList::Entry DeadNonceList::EMPTY = std::numeric_limits<Entry>::max();
 const size_t DeadNonceList::EXPECTED_MARK_COUNT = 5;
 const double DeadNonceList::CAPACITY_UP = 1.2;
 const double DeadNonceList::CAPACITY_DOWN = 0.9;
 const size_t DeadNonceList::EVICT_LIMIT = (1 << 6);
 
+/** \brief initial number of positions in the ring buffer, must be a power of two
+ */
+static const size_t INITIAL_RING_CAPACITY = (1 << 8);
+
+/** \brief number of hash table positions per ring buffer position, must be a power of two
+ *
+ *  Because the hash table never holds more keys than the ring buffer holds entries,
+ *  this bounds the load factor of the hash table at 50%.
+ */
+static const size_t HASHTABLE_EXPANSION = 2;
+
 DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime)
   : m_lifetime(lifetime)
-  , m_queue(m_index.get<0>())
-  , m_ht(m_index.get<1>())
+  , m_ringHead(0)
+  , m_ringSize(0)
   , m_capacity(INITIAL_CAPACITY)
   , m_markInterval(m_lifetime / EXPECTED_MARK_COUNT)
   , m_adjustCapacityInterval(m_lifetime)
@@ -54,8 +66,10 @@ DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime)
     BOOST_THROW_EXCEPTION(std::invalid_argument("lifetime is less than MIN_LIFETIME"));
   }
 
+  this->reallocate(INITIAL_RING_CAPACITY);
+
   for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
-    m_queue.push_back(MARK);
+    this->pushBack(MARK);
   }
 
   m_markEvent = scheduler::schedule(m_markInterval, [this] { mark(); });
@@ -77,26 +91,38 @@ DeadNonceList::~DeadNonceList()
   BOOST_ASSERT_MSG(CAPACITY_UP > 1.0, "CAPACITY_UP must adjust up");
   BOOST_ASSERT_MSG(CAPACITY_DOWN < 1.0, "CAPACITY_DOWN must adjust down");
   static_assert(EVICT_LIMIT >= 1, "EVICT_LIMIT must be at least 1");
+  static_assert((INITIAL_RING_CAPACITY & (INITIAL_RING_CAPACITY - 1)) == 0,
+                "INITIAL_RING_CAPACITY must be a power of two");
+  static_assert((HASHTABLE_EXPANSION & (HASHTABLE_EXPANSION - 1)) == 0 && HASHTABLE_EXPANSION >= 2,
+                "HASHTABLE_EXPANSION must be a power of two, and at least 2");
 }
 
 size_t
 DeadNonceList::size() const
 {
-  return m_queue.size() - this->countMarks();
+  return m_ringSize - this->countMarks();
+}
+
+size_t
+DeadNonceList::getMemoryUsage() const
+{
+  return m_ring.capacity() * sizeof(Entry) +
+         m_keys.capacity() * sizeof(Entry) +
+         m_counts.capacity() * sizeof(uint32_t);
 }
 
 bool
 DeadNonceList::has(const Name& name, uint32_t nonce) const
 {
   Entry entry = DeadNonceList::makeEntry(name, nonce);
-  return m_ht.find(entry) != m_ht.end();
+  return this->countEntry(entry) > 0;
 }
 
 void
 DeadNonceList::add(const Name& name, uint32_t nonce)
 {
   Entry entry = DeadNonceList::makeEntry(name, nonce);
-  m_queue.push_back(entry);
+  this->pushBack(entry);
 
   this->evictEntries();
 }
@@ -105,20 +131,135 @@ DeadNonceList::Entry
 DeadNonceList::makeEntry(const Name& name, uint32_t nonce)
 {
   Block nameWire = name.wireEncode();
-  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
-                            static_cast<uint64_t>(nonce));
+  Entry entry = CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
+                                   static_cast<uint64_t>(nonce));
+  // MARK and EMPTY are reserved
+  if (entry == MARK || entry == EMPTY) {
+    entry = 1;
+  }
+  return entry;
+}
+
+void
+DeadNonceList::pushBack(Entry entry)
+{
+  if (m_ringSize == m_ring.size()) {
+    this->reallocate(m_ring.size() * 2);
+  }
+
+  m_ring[(m_ringHead + m_ringSize) & (m_ring.size() - 1)] = entry;
+  ++m_ringSize;
+  this->indexInsert(entry);
+}
+
+void
+DeadNonceList::popFront()
+{
+  BOOST_ASSERT(m_ringSize > 0);
+
+  Entry entry = m_ring[m_ringHead];
+  m_ringHead = (m_ringHead + 1) & (m_ring.size() - 1);
+  --m_ringSize;
+  this->indexErase(entry);
+}
+
+void
+DeadNonceList::reallocate(size_t ringCapacity)
+{
+  BOOST_ASSERT((ringCapacity & (ringCapacity - 1)) == 0);
+  BOOST_ASSERT(ringCapacity >= m_ringSize);
+
+  std::vector<Entry> ring(ringCapacity);
+  for (size_t i = 0; i < m_ringSize; ++i) {
+    ring[i] = m_ring[(m_ringHead + i) & (m_ring.size() - 1)];
+  }
+  m_ring.swap(ring);
+  m_ringHead = 0;
+
+  std::vector<Entry> keys(ringCapacity * HASHTABLE_EXPANSION, EMPTY);
+  std::vector<uint32_t> counts(ringCapacity * HASHTABLE_EXPANSION, 0);
+  m_keys.swap(keys);
+  m_counts.swap(counts);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (keys[i] != EMPTY) {
+      size_t pos = this->findSlot(keys[i]);
+      m_keys[pos] = keys[i];
+      m_counts[pos] = counts[i];
+    }
+  }
+
+  NFD_LOG_TRACE("reallocate ringCapacity=" << ringCapacity << " bytes=" << this->getMemoryUsage());
+}
+
+size_t
+DeadNonceList::findSlot(Entry entry) const
+{
+  BOOST_ASSERT(entry != EMPTY);
+
+  // entries are hash values, so the low bits are a good position
+  size_t mask = m_keys.size() - 1;
+  size_t pos = static_cast<size_t>(entry) & mask;
+  while (m_keys[pos] != entry && m_keys[pos] != EMPTY) {
+    pos = (pos + 1) & mask;
+  }
+  return pos;
+}
+
+size_t
+DeadNonceList::countEntry(Entry entry) const
+{
+  size_t pos = this->findSlot(entry);
+  return m_keys[pos] == EMPTY ? 0 : m_counts[pos];
+}
+
+void
+DeadNonceList::indexInsert(Entry entry)
+{
+  size_t pos = this->findSlot(entry);
+  if (m_keys[pos] == EMPTY) {
+    m_keys[pos] = entry;
+    m_counts[pos] = 0;
+  }
+  ++m_counts[pos];
+}
+
+void
+DeadNonceList::indexErase(Entry entry)
+{
+  size_t pos = this->findSlot(entry);
+  BOOST_ASSERT(m_keys[pos] == entry);
+  if (--m_counts[pos] > 0) {
+    return;
+  }
+
+  // backward shift deletion keeps probe sequences intact without tombstones
+  size_t mask = m_keys.size() - 1;
+  size_t hole = pos;
+  for (size_t next = (hole + 1) & mask; m_keys[next] != EMPTY; next = (next + 1) & mask) {
+    size_t home = static_cast<size_t>(m_keys[next]) & mask;
+    // the key at next may fill the hole if its home is not cyclically within (hole, next]
+    bool isHomeBetween = hole <= next ? (hole < home && home <= next) :
+                                        (hole < home || home <= next);
+    if (!isHomeBetween) {
+      m_keys[hole] = m_keys[next];
+      m_counts[hole] = m_counts[next];
+      hole = next;
+    }
+  }
+  m_keys[hole] = EMPTY;
+  m_counts[hole] = 0;
 }
 
 size_t
 DeadNonceList::countMarks() const
 {
-  return m_ht.count(MARK);
+  return this->countEntry(MARK);
 }
 
 void
 DeadNonceList::mark()
 {
-  m_queue.push_back(MARK);
+  this->pushBack(MARK);
   size_t nMarks = this->countMarks();
   m_actualMarkCounts.insert(nMarks);
 
@@ -147,20 +288,29 @@ DeadNonceList::adjustCapacity()
   m_actualMarkCounts.clear();
   this->evictEntries();
 
+  // release memory if the ring buffer is mostly unused
+  size_t ringCapacity = m_ring.size();
+  while (ringCapacity > INITIAL_RING_CAPACITY && ringCapacity / 4 >= std::max(m_ringSize, m_capacity)) {
+    ringCapacity /= 2;
+  }
+  if (ringCapacity < m_ring.size()) {
+    this->reallocate(ringCapacity);
+  }
+
   m_adjustCapacityEvent = scheduler::schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
 }
 
 void
 DeadNonceList::evictEntries()
 {
-  ssize_t nOverCapacity = m_queue.size() - m_capacity;
+  ssize_t nOverCapacity = m_ringSize - m_capacity;
   if (nOverCapacity <= 0) // not over capacity
     return;
 
   for (ssize_t nEvict = std::min<ssize_t>(nOverCapacity, EVICT_LIMIT); nEvict > 0; --nEvict) {
-    m_queue.erase(m_queue.begin());
+    this->popFront();
   }
-  BOOST_ASSERT(m_queue.size() >= m_capacity);
+  BOOST_ASSERT(m_ringSize >= m_capacity);
 }
 
 } // namespace nfd
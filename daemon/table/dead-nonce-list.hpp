@@ -27,9 +27,6 @@
 #define NFD_DAEMON_TABLE_DEAD_NONCE_LIST_HPP
 
 #include "core/common.hpp"
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/sequenced_index.hpp>
-#include <boost/multi_index/hashed_index.hpp>
 #include "core/scheduler.hpp"
 
 namespace nfd {
@@ -50,6 +47,11 @@ namespace nfd {
  *  At fixed intervals, the MARK, an entry with a special value, is inserted into the container.
  *  The number of MARKs stored in the container reflects the lifetime of entries,
  *  because MARKs are inserted at fixed intervals.
+ *
+ *  Entries are kept in a ring buffer in insertion order, and indexed by an open addressing
+ *  hash table with linear probing over a contiguous array of keys. Neither structure
+ *  allocates memory per entry; both grow by doubling when the ring buffer is full,
+ *  and shrink when capacity has decreased substantially.
  */
 class DeadNonceList : noncopyable
 {
@@ -88,24 +90,46 @@ public:
   const time::nanoseconds&
   getLifetime() const;
 
-private: // Entry and Index
+  /** \return number of bytes allocated for the ring buffer and the hash table
+   */
+  size_t
+  getMemoryUsage() const;
+
+private: // Entry
   typedef uint64_t Entry;
 
   static Entry
   makeEntry(const Name& name, uint32_t nonce);
 
-  typedef boost::multi_index_container<
-    Entry,
-    boost::multi_index::indexed_by<
-      boost::multi_index::sequenced<>,
-      boost::multi_index::hashed_non_unique<
-        boost::multi_index::identity<Entry>
-      >
-    >
-  > Index;
+private: // ring buffer of entries in insertion order
+  void
+  pushBack(Entry entry);
+
+  void
+  popFront();
+
+  /** \brief reallocate ring buffer and hash table to hold \p ringCapacity entries
+   *  \pre ringCapacity is a power of two, and no less than number of entries in the ring buffer
+   */
+  void
+  reallocate(size_t ringCapacity);
+
+private: // hash table of entries, counting duplicates
+  /** \return position of \p entry in the hash table, or the empty position where it would be
+   */
+  size_t
+  findSlot(Entry entry) const;
+
+  /** \return number of occurrences of \p entry
+   */
+  size_t
+  countEntry(Entry entry) const;
 
-  typedef Index::nth_index<0>::type Queue;
-  typedef Index::nth_index<1>::type Hashtable;
+  void
+  indexInsert(Entry entry);
+
+  void
+  indexErase(Entry entry);
 
 private: // actual lifetime estimation and capacity control
   /** \return number of MARKs in the index
@@ -140,9 +164,24 @@ public:
 
 private:
   time::nanoseconds m_lifetime;
-  Index m_index;
-  Queue& m_queue;
-  Hashtable& m_ht;
+
+  std::vector<Entry> m_ring; ///< ring buffer, size is a power of two
+  size_t m_ringHead; ///< position of the oldest entry
+  size_t m_ringSize; ///< number of entries, including MARKs
+
+  /** \brief keys of the hash table, size is a power of two
+   *
+   *  Positions holding EMPTY are unused. Keys are kept in their own array,
+   *  so that probing scans contiguous memory.
+   */
+  std::vector<Entry> m_keys;
+  std::vector<uint32_t> m_counts; ///< number of occurrences of the key at same position
+
+  /** \brief key of an unused hash table position
+   *
+   *  makeEntry never returns this value.
+   */
+  static const Entry EMPTY;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // actual lifetime estimation and capacity control
 
@@ -56,6 +56,7 @@ Entry::addOrUpdateNextHop(Face& face, uint64_t endpointId, uint64_t cost)
   if (it == m_nextHops.end()) {
     m_nextHops.emplace_back(face, endpointId);
     it = std::prev(m_nextHops.end());
+    this->addFaceReference(face);
   }
   it->setCost(cost);
   this->sortNextHops();
@@ -67,6 +68,7 @@ Entry::removeNextHop(const Face& face, uint64_t endpointId)
   auto it = this->findNextHop(face, endpointId);
   if (it != m_nextHops.end()) {
     m_nextHops.erase(it);
+    this->removeFaceReference(face);
   }
 }
 
@@ -78,6 +80,7 @@ Entry::removeNextHopByFace(const Face& face)
                              return &nexthop.getFace() == &face;
                            });
   m_nextHops.erase(it, m_nextHops.end());
+  this->removeFaceReference(face);
 }
 
 void
@@ -87,5 +90,33 @@ Entry::sortNextHops()
             [] (const NextHop& a, const NextHop& b) { return a.getCost() < b.getCost(); });
 }
 
+void
+Entry::addFaceReference(Face& face)
+{
+  auto it = std::find_if(m_faceReferences.begin(), m_faceReferences.end(),
+                         [&face] (const auto& ref) { return &ref.getFace() == &face; });
+  if (it != m_faceReferences.end()) {
+    return;
+  }
+
+  m_faceReferences.emplace_back(*this, face);
+  face.getTableReferences().fib.push_back(m_faceReferences.back());
+}
+
+void
+Entry::removeFaceReference(const Face& face)
+{
+  bool hasNextHopOnFace = std::any_of(m_nextHops.begin(), m_nextHops.end(),
+                                      [&face] (const NextHop& nexthop) {
+                                        return &nexthop.getFace() == &face;
+                                      });
+  if (hasNextHopOnFace) {
+    return;
+  }
+
+  // FibReference unlinks itself from the face upon destruction
+  m_faceReferences.remove_if([&face] (const auto& ref) { return &ref.getFace() == &face; });
+}
+
 } // namespace fib
 } // namespace nfd
@@ -28,6 +28,8 @@
 
 #include "fib-nexthop.hpp"
 
+#include <list>
+
 namespace nfd {
 
 namespace name_tree {
@@ -108,9 +110,22 @@ private:
   void
   sortNextHops();
 
+  /** \brief links this entry into the table references of \p face
+   *  \note This has no effect if this entry already references \p face.
+   */
+  void
+  addFaceReference(Face& face);
+
+  /** \brief unlinks this entry from the table references of \p face
+   *  \note This has no effect if any NextHop record on \p face remains.
+   */
+  void
+  removeFaceReference(const Face& face);
+
 private:
   Name m_prefix;
   NextHopList m_nextHops;
+  std::list<face::FibReference> m_faceReferences; ///< one per distinct nexthop face
 
   name_tree::Entry* m_nameTreeEntry;
 
@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fib-prefix-length-index.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace nfd {
+namespace fib {
+
+PrefixLengthIndex::Filter::Filter(size_t capacity)
+  : m_capacity(capacity)
+  , m_nItems(0)
+{
+  size_t nBits = 64;
+  while (nBits < capacity * BITS_PER_ITEM) {
+    nBits <<= 1;
+  }
+  m_words.resize(nBits / 64);
+  m_mask = nBits - 1;
+}
+
+bool
+PrefixLengthIndex::Filter::add(name_tree::HashValue h)
+{
+  std::pair<size_t, size_t> bits = this->getBits(h);
+  m_words[bits.first / 64] |= uint64_t{1} << (bits.first % 64);
+  m_words[bits.second / 64] |= uint64_t{1} << (bits.second % 64);
+  return ++m_nItems <= m_capacity;
+}
+
+PrefixLengthIndex::PrefixLengthIndex()
+{
+  this->clear();
+}
+
+void
+PrefixLengthIndex::clear()
+{
+  m_nPrefixes.fill(0);
+  m_lengths.clear();
+  m_filters.clear();
+  m_nErased = 0;
+  m_needsRebuild = false;
+}
+
+void
+PrefixLengthIndex::insert(const Name& prefix)
+{
+  if (m_nPrefixes.at(prefix.size())++ == 0) {
+    // markers are needed at the new length for every longer prefix
+    m_needsRebuild = true;
+  }
+
+  if (!m_needsRebuild) {
+    this->addMarkers(prefix);
+  }
+}
+
+void
+PrefixLengthIndex::erase(const Name& prefix)
+{
+  BOOST_ASSERT(m_nPrefixes.at(prefix.size()) > 0);
+  if (--m_nPrefixes.at(prefix.size()) == 0) {
+    m_needsRebuild = true;
+    return;
+  }
+
+  // stale markers raise the false positive rate
+  size_t nPrefixes = std::accumulate(m_nPrefixes.begin(), m_nPrefixes.end(), size_t{0});
+  if (++m_nErased > std::max<size_t>(nPrefixes, 64)) {
+    m_needsRebuild = true;
+  }
+}
+
+void
+PrefixLengthIndex::allocateFilters()
+{
+  size_t nLongerPrefixes = 0;
+  for (size_t length = m_nPrefixes.size(); length-- > 0;) {
+    nLongerPrefixes += m_nPrefixes[length];
+    if (m_nPrefixes[length] > 0) {
+      m_lengths.push_back(length);
+      // leave room for insertions until the next rebuild
+      m_filters.emplace_back(std::max<size_t>(nLongerPrefixes * 2, 32));
+    }
+  }
+
+  std::reverse(m_lengths.begin(), m_lengths.end());
+  std::reverse(m_filters.begin(), m_filters.end());
+}
+
+void
+PrefixLengthIndex::addMarkers(const Name& prefix)
+{
+  name_tree::HashSequence hashes = name_tree::computeHashes(prefix);
+  for (size_t i = 0; i < m_lengths.size() && m_lengths[i] <= prefix.size(); ++i) {
+    if (!m_filters[i].add(hashes[m_lengths[i]])) {
+      m_needsRebuild = true;
+    }
+  }
+}
+
+} // namespace fib
+} // namespace nfd
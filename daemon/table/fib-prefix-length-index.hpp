@@ -0,0 +1,172 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_FIB_PREFIX_LENGTH_INDEX_HPP
+#define NFD_DAEMON_TABLE_FIB_PREFIX_LENGTH_INDEX_HPP
+
+#include "name-tree-hashtable.hpp"
+
+#include "core/fib-max-depth.hpp"
+
+#include <array>
+
+namespace nfd {
+namespace fib {
+
+/** \brief an index of the distinct prefix lengths in the FIB, with a Bloom filter per length
+ *
+ *  The filter of a length contains the hash of every FIB prefix with that length, and a
+ *  marker for every longer FIB prefix: the hash of its leading components of that length.
+ *  Whether a Name has a marker is thus monotonic over the distinct lengths, except for
+ *  false positives, which allows a binary search for the longest length that may match.
+ *
+ *  Filters cannot remove items, so erasing prefixes leaves stale markers behind, which
+ *  are only false positives. The index asks to be rebuilt when a distinct length appears
+ *  or disappears, when a filter is full, or when many prefixes have been erased.
+ */
+class PrefixLengthIndex : noncopyable
+{
+public:
+  PrefixLengthIndex();
+
+  /** \return distinct prefix lengths, in ascending order
+   */
+  const std::vector<size_t>&
+  getLengths() const
+  {
+    return m_lengths;
+  }
+
+  /** \brief tests whether a FIB prefix or marker may have hash value \p h
+   *  \param lengthIndex index into getLengths()
+   *  \param h name_tree::computeHash of the leading getLengths()[lengthIndex] components
+   */
+  bool
+  mayHaveMarker(size_t lengthIndex, name_tree::HashValue h) const
+  {
+    const Filter& filter = m_filters[lengthIndex];
+    std::pair<size_t, size_t> bits = filter.getBits(h);
+    return filter.test(bits.first) && filter.test(bits.second);
+  }
+
+  /** \brief adds \p prefix into the index
+   */
+  void
+  insert(const Name& prefix);
+
+  /** \brief removes \p prefix from the index
+   */
+  void
+  erase(const Name& prefix);
+
+  /** \return whether the index must be rebuilt before it can be used for lookups
+   */
+  bool
+  needsRebuild() const
+  {
+    return m_needsRebuild;
+  }
+
+  /** \brief rebuilds the index from FIB entries
+   *  \tparam Iterator an iterator of fib::Entry
+   */
+  template<typename Iterator>
+  void
+  rebuild(Iterator first, Iterator last)
+  {
+    this->clear();
+    for (auto it = first; it != last; ++it) {
+      ++m_nPrefixes.at(it->getPrefix().size());
+    }
+    this->allocateFilters();
+    for (auto it = first; it != last; ++it) {
+      this->addMarkers(it->getPrefix());
+    }
+  }
+
+  /** \brief removes all prefixes
+   */
+  void
+  clear();
+
+public:
+  /** \brief number of filter bits per expected item
+   *
+   *  With two bits per item, this gives a false positive rate of about 1.4%.
+   */
+  static constexpr size_t BITS_PER_ITEM = 16;
+
+private:
+  class Filter
+  {
+  public:
+    explicit
+    Filter(size_t capacity);
+
+    std::pair<size_t, size_t>
+    getBits(name_tree::HashValue h) const
+    {
+      uint64_t mixed = static_cast<uint64_t>(h) * 0x9E3779B97F4A7C15ULL;
+      return {mixed & m_mask, (mixed >> 32) & m_mask};
+    }
+
+    bool
+    test(size_t bit) const
+    {
+      return (m_words[bit / 64] >> (bit % 64)) & 1;
+    }
+
+    /** \return false if the filter has reached its capacity
+     */
+    bool
+    add(name_tree::HashValue h);
+
+  private:
+    std::vector<uint64_t> m_words;
+    uint64_t m_mask;
+    size_t m_capacity;
+    size_t m_nItems;
+  };
+
+  void
+  allocateFilters();
+
+  /** \brief adds \p prefix and its markers at shorter distinct lengths into the filters
+   */
+  void
+  addMarkers(const Name& prefix);
+
+private:
+  std::array<size_t, FIB_MAX_DEPTH + 1> m_nPrefixes; ///< number of prefixes of each length
+  std::vector<size_t> m_lengths;
+  std::vector<Filter> m_filters; ///< filter of each distinct length
+  size_t m_nErased; ///< number of prefixes erased since the last rebuild
+  bool m_needsRebuild;
+};
+
+} // namespace fib
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_FIB_PREFIX_LENGTH_INDEX_HPP
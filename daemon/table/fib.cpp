@@ -29,6 +29,8 @@
 
 #include <ndn-cxx/util/concepts.hpp>
 
+#include <algorithm>
+
 namespace nfd {
 namespace fib {
 
@@ -45,6 +47,7 @@ nteHasFibEntry(const name_tree::Entry& nte)
 Fib::Fib(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_isPrefixLengthSearchEnabled(false)
 {
 }
 
@@ -59,9 +62,56 @@ Fib::findLongestPrefixMatchImpl(const K& key) const
   return *s_emptyEntry;
 }
 
+const Entry&
+Fib::findLongestPrefixMatchByLength(const Name& name) const
+{
+  BOOST_ASSERT(!m_prefixLengthIndex.needsRebuild());
+
+  // distinct lengths that are not longer than the Name
+  const std::vector<size_t>& lengths = m_prefixLengthIndex.getLengths();
+  size_t maxLength = std::min(name.size(), getMaxDepth());
+  size_t nLengths = std::upper_bound(lengths.begin(), lengths.end(), maxLength) - lengths.begin();
+  if (nLengths == 0) {
+    return *s_emptyEntry;
+  }
+
+  // components beyond the longest FIB prefix are not hashed
+  name_tree::HashSequence hashes = name_tree::computeHashes(name, lengths[nLengths - 1]);
+
+  // After the search, the filter of lengths[lo] rejects the Name (or lo == nLengths).
+  // Filters have no false negatives, so no FIB prefix of the Name is that long.
+  size_t lo = 0;
+  size_t hi = nLengths;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if (m_prefixLengthIndex.mayHaveMarker(mid, hashes[lengths[mid]])) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+
+  // the longest length with a marker is usually the match; a marker without a FIB entry,
+  // or a false positive, leads to the next shorter lengths
+  for (size_t i = lo; i-- > 0;) {
+    if (!m_prefixLengthIndex.mayHaveMarker(i, hashes[lengths[i]])) {
+      continue;
+    }
+    name_tree::Entry* nte = m_nameTree.findExactMatch(name, lengths[i], hashes);
+    if (nte != nullptr && nte->getFibEntry() != nullptr) {
+      return *nte->getFibEntry();
+    }
+  }
+  return *s_emptyEntry;
+}
+
 const Entry&
 Fib::findLongestPrefixMatch(const Name& prefix) const
 {
+  if (m_isPrefixLengthSearchEnabled) {
+    return this->findLongestPrefixMatchByLength(prefix);
+  }
   return this->findLongestPrefixMatchImpl(prefix);
 }
 
@@ -87,6 +137,26 @@ Fib::findExactMatch(const Name& prefix)
   return nullptr;
 }
 
+void
+Fib::enablePrefixLengthSearch(bool isEnabled)
+{
+  m_isPrefixLengthSearchEnabled = isEnabled;
+  if (isEnabled) {
+    m_prefixLengthIndex.rebuild(this->begin(), this->end());
+  }
+  else {
+    m_prefixLengthIndex.clear();
+  }
+}
+
+void
+Fib::rebuildPrefixLengthIndexIfNeeded()
+{
+  if (m_prefixLengthIndex.needsRebuild()) {
+    m_prefixLengthIndex.rebuild(this->begin(), this->end());
+  }
+}
+
 std::pair<Entry*, bool>
 Fib::insert(const Name& prefix)
 {
@@ -98,6 +168,10 @@ Fib::insert(const Name& prefix)
 
   nte.setFibEntry(make_unique<Entry>(prefix));
   ++m_nItems;
+  if (m_isPrefixLengthSearchEnabled) {
+    m_prefixLengthIndex.insert(prefix);
+    this->rebuildPrefixLengthIndexIfNeeded();
+  }
   return {nte.getFibEntry(), true};
 }
 
@@ -106,7 +180,13 @@ Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
 {
   BOOST_ASSERT(nte != nullptr);
 
+  if (m_isPrefixLengthSearchEnabled) {
+    m_prefixLengthIndex.erase(nte->getName());
+  }
   nte->setFibEntry(nullptr);
+  if (m_isPrefixLengthSearchEnabled) {
+    this->rebuildPrefixLengthIndexIfNeeded();
+  }
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
   }
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_TABLE_FIB_HPP
 
 #include "fib-entry.hpp"
+#include "fib-prefix-length-index.hpp"
 #include "name-tree.hpp"
 
 #include "core/fib-max-depth.hpp"
@@ -83,6 +84,28 @@ public: // lookup
   Entry*
   findExactMatch(const Name& prefix);
 
+  /** \return whether longest prefix match by Name searches over prefix lengths
+   */
+  bool
+  isPrefixLengthSearchEnabled() const
+  {
+    return m_isPrefixLengthSearchEnabled;
+  }
+
+  /** \brief enable or disable longest prefix match over the distinct prefix lengths
+   *
+   *  When disabled, findLongestPrefixMatch(const Name&) probes the NameTree at every length
+   *  from the Name's length down to zero. When enabled, the FIB maintains a PrefixLengthIndex,
+   *  and the lookup binary searches the lengths that exist in the FIB, using the index's
+   *  filters to choose a direction, so that only a few lengths are probed in the NameTree.
+   *  This benefits long Names when the FIB contains few distinct prefix lengths.
+   *
+   *  Lookups by PIT entry or Measurements entry walk up the NameTree from an existing
+   *  entry without hashing the Name, and are unaffected.
+   */
+  void
+  enablePrefixLengthSearch(bool isEnabled);
+
 public: // mutation
   /** \brief Maximum number of components in a FIB entry prefix.
    */
@@ -146,6 +169,12 @@ private:
   const Entry&
   findLongestPrefixMatchImpl(const K& key) const;
 
+  const Entry&
+  findLongestPrefixMatchByLength(const Name& name) const;
+
+  void
+  rebuildPrefixLengthIndexIfNeeded();
+
   void
   erase(name_tree::Entry* nte, bool canDeleteNte = true);
 
@@ -160,6 +189,8 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  bool m_isPrefixLengthSearchEnabled;
+  PrefixLengthIndex m_prefixLengthIndex;
 
   /** \brief the empty FIB entry.
    *
@@ -33,6 +33,8 @@ Entry::Entry(const Name& name, Node* node)
   : m_name(name)
   , m_node(node)
   , m_parent(nullptr)
+  , m_cachedStrategy(nullptr)
+  , m_strategyEpoch(0)
 {
   BOOST_ASSERT(node != nullptr);
   BOOST_ASSERT(name.size() <= NameTree::getMaxDepth());
@@ -152,6 +152,25 @@ public: // attached table entries
   void
   setStrategyChoiceEntry(unique_ptr<strategy_choice::Entry> strategyChoiceEntry);
 
+  /** \return cached effective strategy of this entry,
+   *          or nullptr if nothing was cached since StrategyChoice entered \p epoch
+   *  \note This cache is maintained by StrategyChoice.
+   */
+  fw::Strategy*
+  getCachedStrategy(uint64_t epoch) const
+  {
+    return m_strategyEpoch == epoch ? m_cachedStrategy : nullptr;
+  }
+
+  /** \brief cache effective strategy of this entry, valid while StrategyChoice is in \p epoch
+   */
+  void
+  setCachedStrategy(fw::Strategy* strategy, uint64_t epoch) const
+  {
+    m_cachedStrategy = strategy;
+    m_strategyEpoch = epoch;
+  }
+
   /** \return name tree entry on which a table entry is attached,
    *          or nullptr if the table entry is detached
    *  \note This function is for NameTree internal use. Other components
@@ -175,6 +194,9 @@ private:
   unique_ptr<measurements::Entry> m_measurementsEntry;
   unique_ptr<strategy_choice::Entry> m_strategyChoiceEntry;
 
+  mutable fw::Strategy* m_cachedStrategy;
+  mutable uint64_t m_strategyEpoch;
+
   friend Node* getNode(const Entry& entry);
 };
 
@@ -192,6 +192,23 @@ public:
     return m_buckets[bucket]; // don't use m_bucket.at() for better performance
   }
 
+  /** \brief start loading the bucket for hash value h into cache
+   */
+  void
+  prefetchBucket(HashValue h) const
+  {
+    __builtin_prefetch(&m_buckets[this->computeBucketIndex(h)]);
+  }
+
+  /** \brief start loading the first node in the bucket for hash value h into cache
+   *  \note This reads the bucket, which should have been prefetched some time earlier.
+   */
+  void
+  prefetchNode(HashValue h) const
+  {
+    __builtin_prefetch(m_buckets[this->computeBucketIndex(h)]);
+  }
+
   /** \brief find node for name.getPrefix(prefixLen)
    *  \pre name.size() > prefixLen
    */
@@ -158,6 +158,15 @@ NameTree::findExactMatch(const Name& name, size_t prefixLen) const
   return node == nullptr ? nullptr : &node->entry;
 }
 
+Entry*
+NameTree::findExactMatch(const Name& name, size_t prefixLen, const HashSequence& hashes) const
+{
+  BOOST_ASSERT(prefixLen <= std::min(name.size(), getMaxDepth()));
+
+  const Node* node = m_ht.find(name, prefixLen, hashes);
+  return node == nullptr ? nullptr : &node->entry;
+}
+
 Entry*
 NameTree::findLongestPrefixMatch(const Name& name, const EntrySelector& entrySelector) const
 {
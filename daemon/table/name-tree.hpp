@@ -144,6 +144,27 @@ public: // mutation
   size_t
   eraseIfEmpty(Entry* entry, bool canEraseAncestors = true);
 
+public: // prefetching
+  /** \brief start loading the hashtable bucket for hash value \p h into cache
+   *  \param h hash value computed by name_tree::computeHash
+   */
+  void
+  prefetchBucket(HashValue h) const
+  {
+    m_ht.prefetchBucket(h);
+  }
+
+  /** \brief start loading the first node in the hashtable bucket for \p h into cache
+   *
+   *  Calling prefetchBucket for a batch of names, and then prefetchNode for the same names,
+   *  overlaps the cache misses of looking up those names.
+   */
+  void
+  prefetchNode(HashValue h) const
+  {
+    m_ht.prefetchNode(h);
+  }
+
 public: // matching
   /** \brief exact match lookup
    *  \return entry with \c name.getPrefix(prefixLen), or nullptr if it does not exist
@@ -151,6 +172,14 @@ public: // matching
   Entry*
   findExactMatch(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max()) const;
 
+  /** \brief exact match lookup with precomputed hashes
+   *  \return entry with \c name.getPrefix(prefixLen), or nullptr if it does not exist
+   *  \pre prefixLen <= min(name.size(), getMaxDepth())
+   *  \pre hashes is a prefix of computeHashes(name), and contains at least prefixLen + 1 values
+   */
+  Entry*
+  findExactMatch(const Name& name, size_t prefixLen, const HashSequence& hashes) const;
+
   /** \brief longest prefix matching
    *  \return entry whose name is a prefix of \p name and passes \p entrySelector,
    *          where no other entry with a longer name satisfies those requirements;
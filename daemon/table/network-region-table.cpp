@@ -24,18 +24,18 @@
  */
 
 #include "network-region-table.hpp"
-#include <boost/range/adaptor/map.hpp>
 
 namespace nfd {
 
 bool
 NetworkRegionTable::isInProducerRegion(const DelegationList& forwardingHint) const
 {
-  for (const Name& regionName : *this) {
-    for (const Delegation& delegation : forwardingHint) {
-      if (delegation.name.isPrefixOf(regionName)) {
-        return true;
-      }
+  for (const Delegation& delegation : forwardingHint) {
+    // In canonical order, names under a prefix immediately follow the prefix itself,
+    // so the first region name not less than the delegation name is the only candidate.
+    auto it = this->lower_bound(delegation.name);
+    if (it != this->end() && delegation.name.isPrefixOf(*it)) {
+      return true;
     }
   }
   return false;
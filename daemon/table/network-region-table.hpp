@@ -48,6 +48,8 @@ public:
    *  If any delegation name in the forwarding hint is a prefix of any region name,
    *  the Interest has reached the producer region and should be forwarded according to ‎its Name;
    *  otherwise, the Interest should be forwarded according to the forwarding hint.
+   *
+   *  Each delegation is checked with one O(log n) lookup in the sorted set of region names.
    */
   bool
   isInProducerRegion(const DelegationList& forwardingHint) const;
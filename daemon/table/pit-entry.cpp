@@ -32,7 +32,9 @@ namespace pit {
 Entry::Entry(const Interest& interest)
   : isSatisfied(false)
   , dataFreshnessPeriod(0_ms)
+  , pendingCsLookup(0)
   , m_interest(interest.shared_from_this())
+  , m_nonceFingerprints(0)
   , m_nameTreeEntry(nullptr)
 {
 }
@@ -66,9 +68,11 @@ Entry::insertOrUpdateInRecord(Face& face, const Interest& interest)
   if (it == m_inRecords.end()) {
     m_inRecords.emplace_front(face);
     it = m_inRecords.begin();
+    it->linkTableReference(*this);
   }
 
   it->update(interest);
+  m_nonceFingerprints |= getNonceFingerprint(interest.getNonce());
   return it;
 }
 
@@ -105,9 +109,11 @@ Entry::insertOrUpdateOutRecord(Face& face, const Interest& interest)
   if (it == m_outRecords.end()) {
     m_outRecords.emplace_front(face);
     it = m_outRecords.begin();
+    it->linkTableReference(*this);
   }
 
   it->update(interest);
+  m_nonceFingerprints |= getNonceFingerprint(interest.getNonce());
   return it;
 }
 
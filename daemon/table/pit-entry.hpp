@@ -28,7 +28,7 @@
 
 #include "pit-in-record.hpp"
 #include "pit-out-record.hpp"
-#include "core/scheduler.hpp"
+#include "core/timing-wheel.hpp"
 
 #include <list>
 
@@ -216,12 +216,41 @@ public: // out-record
   void
   deleteOutRecord(const Face& face);
 
+public: // nonce
+  /** \brief tests whether \p nonce may be the last nonce of an in-record or out-record
+   *  \retval false no in-record or out-record has \p nonce as its last nonce
+   *  \retval true some record may have \p nonce as its last nonce;
+   *               the records must be examined to find out which
+   *
+   *  The entry keeps a 64-bit fingerprint set of nonces passed to insertOrUpdateInRecord
+   *  and insertOrUpdateOutRecord. Fingerprints are not removed when a record is deleted
+   *  or refreshed with another nonce, so the set can only produce false positives.
+   *  A PIT entry rarely has more than a few records, so the false positive rate stays low.
+   */
+  bool
+  mayHaveNonce(uint32_t nonce) const
+  {
+    uint64_t mask = getNonceFingerprint(nonce);
+    return (m_nonceFingerprints & mask) == mask;
+  }
+
+private:
+  /** \return a fingerprint with two bits set, taken from the low 12 bits of \p nonce
+   *  \note Nonces are random, so their bits are used directly instead of a hash.
+   */
+  static uint64_t
+  getNonceFingerprint(uint32_t nonce)
+  {
+    return (uint64_t{1} << (nonce & 0x3F)) | (uint64_t{1} << ((nonce >> 6) & 0x3F));
+  }
+
 public:
   /** \brief expiry timer
    *
-   *  This timer is used in forwarding pipelines to delete the entry
+   *  This timer is used in forwarding pipelines to delete the entry.
+   *  It is scheduled on the forwarder's PIT expiry timing wheel.
    */
-  scheduler::EventId expiryTimer;
+  scheduler::TimerId expiryTimer;
 
   /** \brief indicate if PIT entry is satisfied
    */
@@ -232,10 +261,26 @@ public:
    */
   time::milliseconds dataFreshnessPeriod;
 
+  /** \brief identifies the Content Store lookup that has not completed, or 0 if none
+   *
+   *  While a lookup is pending, duplicate Interests are aggregated as in-records,
+   *  and are not passed to the Content Store or the strategy.
+   */
+  uint64_t pendingCsLookup;
+
+  /** \return whether the entry is still in the PIT
+   */
+  bool
+  isInTable() const
+  {
+    return m_nameTreeEntry != nullptr;
+  }
+
 private:
   shared_ptr<const Interest> m_interest;
   InRecordCollection m_inRecords;
   OutRecordCollection m_outRecords;
+  uint64_t m_nonceFingerprints;
 
   name_tree::Entry* m_nameTreeEntry;
 
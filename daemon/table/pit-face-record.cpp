@@ -49,6 +49,14 @@ FaceRecord::update(const Interest& interest)
   m_expiry = m_lastRenewed + lifetime;
 }
 
+void
+FaceRecord::linkTableReference(Entry& entry)
+{
+  BOOST_ASSERT(!m_pitReference.is_linked());
+  m_pitReference = face::PitReference(&entry);
+  m_face.getTableReferences().pit.push_back(m_pitReference);
+}
+
 
 } // namespace pit
 } // namespace nfd
@@ -32,6 +32,8 @@
 namespace nfd {
 namespace pit {
 
+class Entry;
+
 /** \brief contains information about an Interest
  *         on an incoming or outgoing face
  *  \note This is an implementation detail to extract common functionality
@@ -63,11 +65,21 @@ public:
   void
   update(const Interest& interest);
 
+private:
+  /** \brief links this record into the table references of its face
+   *  \param entry PIT entry that contains this record
+   */
+  void
+  linkTableReference(Entry& entry);
+
 private:
   Face& m_face;
   uint32_t m_lastNonce;
   time::steady_clock::TimePoint m_lastRenewed;
   time::steady_clock::TimePoint m_expiry;
+  face::PitReference m_pitReference;
+
+  friend class Entry;
 };
 
 inline Face&
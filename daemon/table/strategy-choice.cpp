@@ -51,6 +51,7 @@ StrategyChoice::StrategyChoice(Forwarder& forwarder)
   : m_forwarder(forwarder)
   , m_nameTree(m_forwarder.getNameTree())
   , m_nItems(0)
+  , m_epoch(1)
 {
 }
 
@@ -66,6 +67,7 @@ StrategyChoice::setDefaultStrategy(const Name& strategyName)
   name_tree::Entry& nte = m_nameTree.lookup(Name());
   nte.setStrategyChoiceEntry(std::move(entry));
   ++m_nItems;
+  this->invalidateCachedStrategies();
 }
 
 StrategyChoice::InsertResult
@@ -112,6 +114,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 
   this->changeStrategy(*entry, *oldStrategy, *strategy);
   entry->setStrategy(std::move(strategy));
+  this->invalidateCachedStrategies();
   return InsertResult::OK;
 }
 
@@ -161,6 +164,7 @@ StrategyChoice::erase(const Name& prefix)
   nte->setStrategyChoiceEntry(nullptr);
   m_nameTree.eraseIfEmpty(nte);
   --m_nItems;
+  this->invalidateCachedStrategies();
 }
 
 std::pair<bool, Name>
@@ -194,16 +198,36 @@ StrategyChoice::findEffectiveStrategy(const Name& prefix) const
   return this->findEffectiveStrategyImpl(prefix);
 }
 
+Strategy&
+StrategyChoice::findEffectiveStrategyCached(const name_tree::Entry& nte) const
+{
+  Strategy* strategy = nte.getCachedStrategy(m_epoch);
+  if (strategy == nullptr) {
+    strategy = &this->findEffectiveStrategyImpl(nte);
+    nte.setCachedStrategy(strategy, m_epoch);
+  }
+  return *strategy;
+}
+
 Strategy&
 StrategyChoice::findEffectiveStrategy(const pit::Entry& pitEntry) const
 {
-  return this->findEffectiveStrategyImpl(pitEntry);
+  const name_tree::Entry* nte = m_nameTree.getEntry(pitEntry);
+  BOOST_ASSERT(nte != nullptr);
+  if (nte->getName().size() != pitEntry.getName().size()) {
+    // PIT entry name either exceeds depth limit or ends with an implicit digest:
+    // a deeper StrategyChoice entry may apply, which is not reflected in the cache
+    return this->findEffectiveStrategyImpl(pitEntry);
+  }
+  return this->findEffectiveStrategyCached(*nte);
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const measurements::Entry& measurementsEntry) const
 {
-  return this->findEffectiveStrategyImpl(measurementsEntry);
+  const name_tree::Entry* nte = m_nameTree.getEntry(measurementsEntry);
+  BOOST_ASSERT(nte != nullptr);
+  return this->findEffectiveStrategyCached(*nte);
 }
 
 static inline void
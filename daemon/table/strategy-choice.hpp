@@ -140,14 +140,16 @@ public: // effective strategy
 
   /** \brief get effective strategy for pitEntry
    *
-   *  This is equivalent to .findEffectiveStrategy(pitEntry.getName())
+   *  This is equivalent to .findEffectiveStrategy(pitEntry.getName()),
+   *  but usually answered from the strategy cached on the name tree entry.
    */
   fw::Strategy&
   findEffectiveStrategy(const pit::Entry& pitEntry) const;
 
   /** \brief get effective strategy for measurementsEntry
    *
-   *  This is equivalent to .findEffectiveStrategy(measurementsEntry.getName())
+   *  This is equivalent to .findEffectiveStrategy(measurementsEntry.getName()),
+   *  but usually answered from the strategy cached on the name tree entry.
    */
   fw::Strategy&
   findEffectiveStrategy(const measurements::Entry& measurementsEntry) const;
@@ -188,6 +190,22 @@ private:
   fw::Strategy&
   findEffectiveStrategyImpl(const K& key) const;
 
+  /** \brief get effective strategy for \p nte, using the strategy cached on \p nte if valid
+   */
+  fw::Strategy&
+  findEffectiveStrategyCached(const name_tree::Entry& nte) const;
+
+  /** \brief invalidate effective strategies cached on name tree entries
+   *
+   *  This must be called whenever a StrategyChoice entry is inserted, erased, or
+   *  changes its strategy.
+   */
+  void
+  invalidateCachedStrategies()
+  {
+    ++m_epoch;
+  }
+
   Range
   getRange() const;
 
@@ -195,6 +213,13 @@ private:
   Forwarder& m_forwarder;
   NameTree& m_nameTree;
   size_t m_nItems;
+
+  /** \brief epoch of the effective strategy cache
+   *
+   *  An effective strategy cached on a name tree entry is valid only if it was cached
+   *  in the current epoch. Name tree entries start with epoch 0, which is never current.
+   */
+  uint64_t m_epoch;
 };
 
 std::ostream&
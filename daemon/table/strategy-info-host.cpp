@@ -25,12 +25,77 @@
 
 #include "strategy-info-host.hpp"
 
+#include <algorithm>
+
 namespace nfd {
 
+const StrategyInfoHost::Item*
+StrategyInfoHost::findItem(int typeId) const
+{
+  for (const Item& item : m_inlineItems) {
+    if (item.info != nullptr && item.typeId == typeId) {
+      return &item;
+    }
+  }
+
+  if (m_overflowItems != nullptr) {
+    for (const Item& item : *m_overflowItems) {
+      if (item.typeId == typeId) {
+        return &item;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+StrategyInfoHost::Item&
+StrategyInfoHost::allocateItem(int typeId)
+{
+  for (Item& item : m_inlineItems) {
+    if (item.info == nullptr) {
+      item.typeId = typeId;
+      return item;
+    }
+  }
+
+  if (m_overflowItems == nullptr) {
+    m_overflowItems = make_unique<std::vector<Item>>();
+  }
+  m_overflowItems->push_back({typeId, nullptr});
+  return m_overflowItems->back();
+}
+
+size_t
+StrategyInfoHost::eraseItem(int typeId)
+{
+  for (Item& item : m_inlineItems) {
+    if (item.info != nullptr && item.typeId == typeId) {
+      item.info.reset();
+      return 1;
+    }
+  }
+
+  if (m_overflowItems != nullptr) {
+    auto it = std::find_if(m_overflowItems->begin(), m_overflowItems->end(),
+                           [typeId] (const Item& item) { return item.typeId == typeId; });
+    if (it != m_overflowItems->end()) {
+      std::swap(*it, m_overflowItems->back());
+      m_overflowItems->pop_back();
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
 void
 StrategyInfoHost::clearStrategyInfo()
 {
-  m_items.clear();
+  for (Item& item : m_inlineItems) {
+    item.info.reset();
+  }
+  m_overflowItems.reset();
 }
 
 } // namespace nfd
@@ -28,6 +28,8 @@
 
 #include "fw/strategy-info.hpp"
 
+#include <array>
+
 namespace nfd {
 
 /** \brief base class for an entity onto which StrategyInfo items may be placed
@@ -46,11 +48,11 @@ public:
     static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                   "T must inherit from StrategyInfo");
 
-    auto it = m_items.find(T::getTypeId());
-    if (it == m_items.end()) {
+    const Item* item = this->findItem(T::getTypeId());
+    if (item == nullptr) {
       return nullptr;
     }
-    return static_cast<T*>(it->second.get());
+    return static_cast<T*>(item->info.get());
   }
 
   /** \brief insert a StrategyInfo item
@@ -65,12 +67,15 @@ public:
     static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                   "T must inherit from StrategyInfo");
 
-    unique_ptr<fw::StrategyInfo>& item = m_items[T::getTypeId()];
-    bool isNew = (item == nullptr);
-    if (isNew) {
-      item.reset(new T(std::forward<A>(args)...));
+    const Item* item = this->findItem(T::getTypeId());
+    if (item != nullptr) {
+      return {static_cast<T*>(item->info.get()), false};
     }
-    return {static_cast<T*>(item.get()), isNew};
+
+    unique_ptr<T> info(new T(std::forward<A>(args)...));
+    T* infoPtr = info.get();
+    this->allocateItem(T::getTypeId()).info = std::move(info);
+    return {infoPtr, true};
   }
 
   /** \brief erase a StrategyInfo item
@@ -84,7 +89,7 @@ public:
     static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                   "T must inherit from StrategyInfo");
 
-    return m_items.erase(T::getTypeId());
+    return this->eraseItem(T::getTypeId());
   }
 
   /** \brief clear all StrategyInfo items
@@ -93,7 +98,37 @@ public:
   clearStrategyInfo();
 
 private:
-  std::unordered_map<int, unique_ptr<fw::StrategyInfo>> m_items;
+  struct Item
+  {
+    int typeId = 0;
+    unique_ptr<fw::StrategyInfo> info; ///< nullptr indicates an unused slot
+  };
+
+  /** \return item of \p typeId, or nullptr if it does not exist
+   */
+  const Item*
+  findItem(int typeId) const;
+
+  /** \return an unused item labeled with \p typeId
+   *  \pre an item of \p typeId does not exist
+   */
+  Item&
+  allocateItem(int typeId);
+
+  size_t
+  eraseItem(int typeId);
+
+private:
+  /** \brief number of items stored inline in the host
+   *
+   *  Most strategies place at most one or two StrategyInfo types on an entry,
+   *  so these slots avoid a heap table on every PIT entry, face record, and
+   *  measurements entry.
+   */
+  static constexpr size_t N_INLINE_ITEMS = 2;
+
+  std::array<Item, N_INLINE_ITEMS> m_inlineItems;
+  unique_ptr<std::vector<Item>> m_overflowItems; ///< allocated when inline slots are full
 };
 
 } // namespace nfd
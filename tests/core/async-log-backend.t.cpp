@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/async-log-backend.hpp"
+#include "core/logger.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <ndn-cxx/util/logging.hpp>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <thread>
+
+NFD_LOG_INIT(TestAsyncLogBackend);
+
+namespace nfd {
+namespace tests {
+
+using ndn::util::LogLevel;
+
+static std::vector<std::string>
+splitLines(const std::string& output)
+{
+  std::vector<std::string> lines;
+  std::istringstream is(output);
+  std::string line;
+  while (std::getline(is, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+static void
+submitMessage(LogLevel level, const std::string& module, int i)
+{
+  AsyncLogBackend::beginMessage() << "message " << i;
+  AsyncLogBackend::submit(level, module);
+}
+
+BOOST_FIXTURE_TEST_SUITE(TestAsyncLogBackend, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Submit)
+{
+  static const std::string module = "nfd.Module";
+  std::ostringstream os;
+  BOOST_CHECK_EQUAL(AsyncLogBackend::isActive(), false);
+
+  AsyncLogBackend backend(1024, os);
+  BOOST_CHECK_EQUAL(AsyncLogBackend::isActive(), true);
+  BOOST_CHECK_THROW(AsyncLogBackend(16, os), std::logic_error);
+
+  for (int i = 0; i < 100; ++i) {
+    submitMessage(LogLevel::DEBUG, module, i);
+  }
+  backend.stop();
+  BOOST_CHECK_EQUAL(AsyncLogBackend::isActive(), false);
+  BOOST_CHECK_EQUAL(backend.getNDropped(), 0);
+
+  auto lines = splitLines(os.str());
+  BOOST_REQUIRE_EQUAL(lines.size(), 100);
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK(boost::ends_with(lines[i], " DEBUG: [nfd.Module] message " + to_string(i)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Drop)
+{
+  static const std::string module = "nfd.Module";
+  const int nMessages = 10000;
+  std::ostringstream os;
+
+  AsyncLogBackend backend(4, os);
+  for (int i = 0; i < nMessages; ++i) {
+    submitMessage(LogLevel::INFO, module, i);
+  }
+  backend.stop();
+
+  // every message is either written or counted in a drop report
+  uint64_t nWritten = 0;
+  uint64_t nReportedDrops = 0;
+  for (const auto& line : splitLines(os.str())) {
+    if (boost::ends_with(line, " log messages dropped")) {
+      BOOST_CHECK(line.find(" WARN: [nfd.AsyncLogBackend] ") != std::string::npos);
+      auto pos = line.rfind("] ") + 2;
+      nReportedDrops += std::stoull(line.substr(pos));
+    }
+    else {
+      ++nWritten;
+    }
+  }
+  BOOST_CHECK_GT(backend.getNDropped(), 0);
+  BOOST_CHECK_EQUAL(nReportedDrops, backend.getNDropped());
+  BOOST_CHECK_EQUAL(nWritten + nReportedDrops, nMessages);
+}
+
+BOOST_AUTO_TEST_CASE(MultipleThreads)
+{
+  static const std::string module = "nfd.Module";
+  const int nThreads = 4;
+  const int nMessages = 200;
+  std::ostringstream os;
+
+  AsyncLogBackend backend(nMessages, os);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nThreads; ++t) {
+    threads.emplace_back([t] {
+      for (int i = 0; i < nMessages; ++i) {
+        submitMessage(LogLevel::DEBUG, module, t * nMessages + i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  backend.stop();
+  BOOST_CHECK_EQUAL(backend.getNDropped(), 0);
+
+  // messages of each thread are written in submission order
+  std::vector<int> lastSeen(nThreads, -1);
+  auto lines = splitLines(os.str());
+  BOOST_CHECK_EQUAL(lines.size(), nThreads * nMessages);
+  for (const auto& line : lines) {
+    int i = std::stoi(line.substr(line.rfind(' ') + 1));
+    BOOST_CHECK_LT(lastSeen[i / nMessages], i);
+    lastSeen[i / nMessages] = i;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(LogMacros)
+{
+  ndn::util::Logging::setLevel("nfd.TestAsyncLogBackend", LogLevel::INFO);
+  std::ostringstream os;
+  {
+    AsyncLogBackend backend(16, os);
+    NFD_LOG_INFO("enabled " << 1);
+    NFD_LOG_DEBUG("disabled " << 2);
+  }
+  ndn::util::Logging::setLevel("nfd.TestAsyncLogBackend", LogLevel::NONE);
+
+  auto lines = splitLines(os.str());
+  BOOST_REQUIRE_EQUAL(lines.size(), 1);
+  BOOST_CHECK(boost::ends_with(lines[0], " INFO: [nfd.TestAsyncLogBackend] enabled 1"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestAsyncLogBackend
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,76 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/cs-erase-job.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestCsEraseJob, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Encode)
+{
+  CsEraseJob job1;
+  job1.setName("/ZSfo8NvW")
+      .setNErased(7140);
+  Block wire = job1.wireEncode();
+  BOOST_CHECK_EQUAL(wire.type(), CsEraseJob::TLV_CS_ERASE_JOB);
+
+  CsEraseJob job2(wire);
+  BOOST_CHECK_EQUAL(job2.getName(), "/ZSfo8NvW");
+  BOOST_CHECK_EQUAL(job2.getNErased(), 7140);
+  BOOST_CHECK_EQUAL(job1, job2);
+
+  job2.setNErased(7141);
+  BOOST_CHECK_NE(job1, job2);
+  BOOST_CHECK_EQUAL(CsEraseJob(job2.wireEncode()).getNErased(), 7141);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeError)
+{
+  using namespace ndn::encoding;
+
+  Block wrongType = makeNonNegativeIntegerBlock(CsEraseJob::TLV_N_ERASED, 1);
+  BOOST_CHECK_THROW(CsEraseJob{wrongType}, CsEraseJob::Error);
+
+  Block noName(CsEraseJob::TLV_CS_ERASE_JOB);
+  noName.push_back(makeNonNegativeIntegerBlock(CsEraseJob::TLV_N_ERASED, 1));
+  noName.encode();
+  BOOST_CHECK_THROW(CsEraseJob{noName}, CsEraseJob::Error);
+
+  Block noNErased(CsEraseJob::TLV_CS_ERASE_JOB);
+  noNErased.push_back(Name("/A").wireEncode());
+  noNErased.encode();
+  BOOST_CHECK_THROW(CsEraseJob{noNErased}, CsEraseJob::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsEraseJob
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/latency-histogram.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestLatencyHistogram, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(BucketIndex)
+{
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketIndex(0), 0);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketIndex(1), 0);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketIndex(2), 1);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketIndex(3), 1);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketIndex(1023), 9);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketIndex(1024), 10);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketIndex(uint64_t(1) << 40), LatencyHistogram::N_BUCKETS - 1);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketIndex(std::numeric_limits<uint64_t>::max()),
+                    LatencyHistogram::N_BUCKETS - 1);
+
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketUpperBound(0), 2);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketUpperBound(10), 2048);
+}
+
+BOOST_AUTO_TEST_CASE(AddAndQuantile)
+{
+  LatencyHistogram h;
+  BOOST_CHECK_EQUAL(h.getCount(), 0);
+  BOOST_CHECK_EQUAL(h.getQuantile(0.5), 0);
+
+  for (int i = 0; i < 98; ++i) {
+    h.add(1500);
+  }
+  h.add(5000);
+  h.add(300000);
+  BOOST_CHECK_EQUAL(h.getCount(), 100);
+  BOOST_CHECK_EQUAL(h.getTotal(), 98 * 1500 + 5000 + 300000);
+  BOOST_CHECK_EQUAL(h.getBuckets()[10], 98);
+  BOOST_CHECK_EQUAL(h.getBuckets()[12], 1);
+  BOOST_CHECK_EQUAL(h.getBuckets()[18], 1);
+
+  BOOST_CHECK_EQUAL(h.getQuantile(0.0), 2048);
+  BOOST_CHECK_EQUAL(h.getQuantile(0.5), 2048);
+  BOOST_CHECK_EQUAL(h.getQuantile(0.98), 2048);
+  BOOST_CHECK_EQUAL(h.getQuantile(0.99), 8192);
+  BOOST_CHECK_EQUAL(h.getQuantile(1.0), 524288);
+
+  h.reset();
+  BOOST_CHECK_EQUAL(h.getCount(), 0);
+  BOOST_CHECK_EQUAL(h.getTotal(), 0);
+  BOOST_CHECK_EQUAL(h.getBuckets()[10], 0);
+}
+
+BOOST_AUTO_TEST_CASE(Sampling)
+{
+  LatencyHistogram h;
+  int nSampled = 0;
+  for (uint64_t i = 0; i < 4 * LatencyHistogram::SAMPLE_INTERVAL; ++i) {
+    if (h.shouldSample()) {
+      BOOST_CHECK_EQUAL(i % LatencyHistogram::SAMPLE_INTERVAL, 0);
+      ++nSampled;
+    }
+  }
+  BOOST_CHECK_EQUAL(nSampled, 4);
+}
+
+BOOST_AUTO_TEST_CASE(ScopedSample)
+{
+  LatencyHistogram h;
+  for (uint64_t i = 0; i < LatencyHistogram::SAMPLE_INTERVAL + 1; ++i) {
+    ScopedLatencySample sample(h);
+  }
+  {
+    LatencyHistogram h2;
+    ScopedLatencySample sample(h2);
+    sample.stop();
+    sample.stop();
+#ifndef DISABLE_LATENCY_HISTOGRAMS
+    BOOST_CHECK_EQUAL(h2.getCount(), 1);
+#endif // DISABLE_LATENCY_HISTOGRAMS
+  }
+
+#ifdef DISABLE_LATENCY_HISTOGRAMS
+  BOOST_CHECK_EQUAL(h.getCount(), 0);
+#else
+  BOOST_CHECK_EQUAL(h.getCount(), 2);
+#endif // DISABLE_LATENCY_HISTOGRAMS
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLatencyHistogram
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/spsc-ring.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <thread>
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestSpscRing, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(PushPop)
+{
+  SpscRing<int> ring(3);
+  BOOST_CHECK_EQUAL(ring.capacity(), 4);
+  BOOST_CHECK_EQUAL(ring.size(), 0);
+
+  int item = 0;
+  BOOST_CHECK_EQUAL(ring.pop(item), false);
+
+  for (int i = 1; i <= 4; ++i) {
+    BOOST_CHECK_EQUAL(ring.push(int{i}), true);
+  }
+  BOOST_CHECK_EQUAL(ring.size(), 4);
+  BOOST_CHECK_EQUAL(ring.push(5), false);
+
+  BOOST_CHECK_EQUAL(ring.pop(item), true);
+  BOOST_CHECK_EQUAL(item, 1);
+  BOOST_CHECK_EQUAL(ring.push(5), true);
+
+  for (int i = 2; i <= 5; ++i) {
+    BOOST_CHECK_EQUAL(ring.pop(item), true);
+    BOOST_CHECK_EQUAL(item, i);
+  }
+  BOOST_CHECK_EQUAL(ring.pop(item), false);
+  BOOST_CHECK_EQUAL(ring.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MoveOnly)
+{
+  SpscRing<unique_ptr<int>> ring(2);
+  auto p1 = make_unique<int>(1);
+  auto p2 = make_unique<int>(2);
+  auto p3 = make_unique<int>(3);
+  BOOST_CHECK_EQUAL(ring.push(std::move(p1)), true);
+  BOOST_CHECK_EQUAL(ring.push(std::move(p2)), true);
+  BOOST_CHECK(p1 == nullptr);
+
+  // a rejected item is not moved from
+  BOOST_CHECK_EQUAL(ring.push(std::move(p3)), false);
+  BOOST_REQUIRE(p3 != nullptr);
+  BOOST_CHECK_EQUAL(*p3, 3);
+
+  unique_ptr<int> item;
+  BOOST_CHECK_EQUAL(ring.pop(item), true);
+  BOOST_REQUIRE(item != nullptr);
+  BOOST_CHECK_EQUAL(*item, 1);
+}
+
+BOOST_AUTO_TEST_CASE(TwoThreads)
+{
+  const size_t nItems = 100000;
+  SpscRing<size_t> ring(64);
+
+  size_t nReceived = 0;
+  bool isOrdered = true;
+  std::thread consumer([&] {
+    size_t item = 0;
+    while (nReceived < nItems) {
+      if (!ring.pop(item)) {
+        std::this_thread::yield();
+        continue;
+      }
+      isOrdered = isOrdered && item == nReceived;
+      ++nReceived;
+    }
+  });
+
+  for (size_t i = 0; i < nItems;) {
+    size_t item = i;
+    if (ring.push(std::move(item))) {
+      ++i;
+    }
+    else {
+      std::this_thread::yield();
+    }
+  }
+  consumer.join();
+
+  BOOST_CHECK_EQUAL(nReceived, nItems);
+  BOOST_CHECK(isOrdered);
+  BOOST_CHECK_EQUAL(ring.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSpscRing
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/timing-wheel.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+using scheduler::TimingWheel;
+using scheduler::TimerId;
+
+BOOST_FIXTURE_TEST_SUITE(TestTimingWheel, UnitTestTimeFixture)
+
+BOOST_AUTO_TEST_CASE(ScheduleCancel)
+{
+  TimingWheel wheel;
+  int count1 = 0, count2 = 0, count3 = 0;
+
+  wheel.schedule(500_ms, [&] {
+    BOOST_CHECK_EQUAL(count3, 1);
+    ++count1;
+  });
+
+  TimerId id2 = wheel.schedule(1_s, [&] { ++count2; });
+  wheel.cancel(id2);
+
+  wheel.schedule(250_ms, [&] {
+    BOOST_CHECK_EQUAL(count1, 0);
+    ++count3;
+  });
+  BOOST_CHECK_EQUAL(wheel.size(), 2);
+
+  this->advanceClocks(1_ms, 249);
+  BOOST_CHECK_EQUAL(count3, 0);
+  this->advanceClocks(1_ms, 1);
+  BOOST_CHECK_EQUAL(count3, 1);
+
+  this->advanceClocks(1_ms, 249);
+  BOOST_CHECK_EQUAL(count1, 0);
+  this->advanceClocks(1_ms, 1);
+  BOOST_CHECK_EQUAL(count1, 1);
+
+  this->advanceClocks(10_ms, 100);
+  BOOST_CHECK_EQUAL(count2, 0);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+
+  // canceling a fired or canceled timer has no effect
+  wheel.cancel(id2);
+  wheel.cancel(TimerId());
+}
+
+BOOST_AUTO_TEST_CASE(ZeroDelay)
+{
+  TimingWheel wheel;
+  int count = 0;
+  wheel.schedule(0_ms, [&] { ++count; });
+
+  this->advanceClocks(1_ms, 1);
+  BOOST_CHECK_EQUAL(count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(Cascade)
+{
+  TimingWheel wheel;
+  std::vector<time::steady_clock::TimePoint> fired;
+  const auto start = time::steady_clock::now();
+
+  // delays cover levels 0, 1, and 2
+  const std::vector<time::milliseconds> delays{3_ms, 255_ms, 256_ms, 1000_ms, 65535_ms, 70_s};
+  for (time::milliseconds delay : delays) {
+    wheel.schedule(delay, [&] { fired.push_back(time::steady_clock::now()); });
+  }
+
+  this->advanceClocks(1_ms, 71_s);
+  BOOST_REQUIRE_EQUAL(fired.size(), delays.size());
+  for (size_t i = 0; i < delays.size(); ++i) {
+    BOOST_CHECK_GE(fired[i] - start, delays[i]);
+    BOOST_CHECK_LE(fired[i] - start, delays[i] + TimingWheel::RESOLUTION);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(RescheduleInCallback)
+{
+  TimingWheel wheel;
+  int count = 0;
+  TimerId id;
+  std::function<void()> callback = [&] {
+    ++count;
+    wheel.cancel(id); // timer is no longer pending, so this has no effect
+    if (count < 10) {
+      id = wheel.schedule(5_ms, callback);
+    }
+  };
+  id = wheel.schedule(5_ms, callback);
+
+  this->advanceClocks(1_ms, 100);
+  BOOST_CHECK_EQUAL(count, 10);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ManyTimers)
+{
+  TimingWheel wheel;
+  const size_t nTimers = 2000;
+  size_t nFired = 0;
+  std::vector<TimerId> ids;
+  for (size_t i = 0; i < nTimers; ++i) {
+    ids.push_back(wheel.schedule(time::milliseconds(i), [&] { ++nFired; }));
+  }
+  for (size_t i = 0; i < nTimers; i += 2) {
+    wheel.cancel(ids[i]);
+  }
+  BOOST_CHECK_EQUAL(wheel.size(), nTimers / 2);
+
+  this->advanceClocks(10_ms, 3_s);
+  BOOST_CHECK_EQUAL(nFired, nTimers / 2);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Context)
+{
+  std::vector<int> fired;
+  TimingWheel wheel([&] (const shared_ptr<void>& context) {
+    fired.push_back(*static_pointer_cast<int>(context));
+  });
+
+  auto context1 = make_shared<int>(1);
+  auto context2 = make_shared<int>(2);
+  wheel.schedule(20_ms, context1);
+  TimerId id2 = wheel.schedule(10_ms, context2);
+  wheel.schedule(5_ms, [&] { fired.push_back(0); });
+  BOOST_CHECK_EQUAL(context2.use_count(), 2);
+
+  // canceling releases the context
+  wheel.cancel(id2);
+  BOOST_CHECK_EQUAL(context2.use_count(), 1);
+
+  this->advanceClocks(1_ms, 30);
+  std::vector<int> expected{0, 1};
+  BOOST_CHECK_EQUAL_COLLECTIONS(fired.begin(), fired.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(context1.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTimingWheel
+
+} // namespace tests
+} // namespace nfd
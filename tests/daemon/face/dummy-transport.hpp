@@ -94,6 +94,16 @@ public:
     this->receive(Packet(std::move(block)));
   }
 
+  void
+  receiveBurst(std::vector<Block> blocks)
+  {
+    this->beginReceiveBurst();
+    for (Block& block : blocks) {
+      this->receive(Packet(std::move(block)));
+    }
+    this->endReceiveBurst();
+  }
+
 protected:
   bool
   canChangePersistencyToImpl(ndn::nfd::FacePersistency newPersistency) const override
@@ -72,6 +72,8 @@ BOOST_AUTO_TEST_CASE(StaticProperties)
 
   face->setId(222);
   BOOST_CHECK_EQUAL(face->getId(), 222);
+  BOOST_REQUIRE(face->getIncomingFaceIdTag() != nullptr);
+  BOOST_CHECK_EQUAL(*face->getIncomingFaceIdTag(), 222);
 
   face->setPersistency(ndn::nfd::FACE_PERSISTENCY_ON_DEMAND);
   BOOST_CHECK_EQUAL(face->getPersistency(), ndn::nfd::FACE_PERSISTENCY_ON_DEMAND);
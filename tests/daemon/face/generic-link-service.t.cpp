@@ -272,6 +272,71 @@ BOOST_AUTO_TEST_CASE(ReceiveIdlePacket)
   BOOST_CHECK_EQUAL(receivedNacks.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(ReceiveBurst)
+{
+  // Initialize with Options that disables all services
+  GenericLinkService::Options options;
+  options.allowLocalFields = false;
+  initialize(options);
+
+  std::vector<ReceiveBatch> receivedBatches;
+  std::string order;
+  face->afterReceiveBatch.connect([&] (const ReceiveBatch& batch) {
+    receivedBatches.push_back(batch);
+    order += "batch,";
+  });
+  face->afterReceiveNack.connect([&] (const lp::Nack&) { order += "nack,"; });
+
+  shared_ptr<Interest> interest1 = makeInterest("/nhv8Bs7F", 1);
+  shared_ptr<Data> data1 = makeData("/YCGf4ZpN");
+  lp::Nack nack1 = makeNack("/cPs1F5Ea", 323, lp::NackReason::NO_ROUTE);
+  lp::Packet nackPacket;
+  nackPacket.set<lp::FragmentField>(std::make_pair(
+    nack1.getInterest().wireEncode().begin(), nack1.getInterest().wireEncode().end()));
+  nackPacket.set<lp::NackField>(nack1.getHeader());
+  shared_ptr<Interest> interest2 = makeInterest("/UeOAQHqf", 2);
+
+  transport->receiveBurst({interest1->wireEncode(), data1->wireEncode(),
+                           nackPacket.wireEncode(), interest2->wireEncode()});
+
+  // Interests and Data are not delivered one by one when the batch signal has a handler
+  BOOST_CHECK_EQUAL(receivedInterests.size(), 0);
+  BOOST_CHECK_EQUAL(receivedData.size(), 0);
+  BOOST_CHECK_EQUAL(receivedNacks.size(), 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nInInterests, 2);
+  BOOST_CHECK_EQUAL(service->getCounters().nInData, 1);
+
+  // Nack is delivered after the packets that arrived before it
+  BOOST_CHECK_EQUAL(order, "batch,nack,batch,");
+  BOOST_REQUIRE_EQUAL(receivedBatches.size(), 2);
+  BOOST_REQUIRE_EQUAL(receivedBatches[0].size(), 2);
+  BOOST_REQUIRE(receivedBatches[0][0].interest != nullptr);
+  BOOST_CHECK_EQUAL(*receivedBatches[0][0].interest, *interest1);
+  BOOST_CHECK(receivedBatches[0][0].data == nullptr);
+  BOOST_CHECK(receivedBatches[0][1].interest == nullptr);
+  BOOST_REQUIRE(receivedBatches[0][1].data != nullptr);
+  BOOST_CHECK_EQUAL(*receivedBatches[0][1].data, *data1);
+  BOOST_REQUIRE_EQUAL(receivedBatches[1].size(), 1);
+  BOOST_REQUIRE(receivedBatches[1][0].interest != nullptr);
+  BOOST_CHECK_EQUAL(*receivedBatches[1][0].interest, *interest2);
+
+  // a burst longer than MAX_RECEIVE_BATCH is split
+  receivedBatches.clear();
+  std::vector<Block> burst;
+  for (size_t i = 0; i < LinkService::MAX_RECEIVE_BATCH + 8; ++i) {
+    burst.push_back(makeInterest(Name("/mJ2d6cG5").appendSequenceNumber(i), i)->wireEncode());
+  }
+  transport->receiveBurst(burst);
+  BOOST_REQUIRE_EQUAL(receivedBatches.size(), 2);
+  BOOST_CHECK_EQUAL(receivedBatches[0].size(), LinkService::MAX_RECEIVE_BATCH);
+  BOOST_CHECK_EQUAL(receivedBatches[1].size(), 8);
+
+  // packets outside a burst are delivered one by one
+  transport->receivePacket(interest1->wireEncode());
+  BOOST_CHECK_EQUAL(receivedInterests.size(), 1);
+  BOOST_CHECK_EQUAL(receivedBatches.size(), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // SimpleSendReceive
 
 BOOST_AUTO_TEST_SUITE(Fragmentation)
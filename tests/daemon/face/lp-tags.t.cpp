@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/lp-tags.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestLpTags, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(HopCount)
+{
+  shared_ptr<lp::HopCountTag> tag1 = makeHopCountTag(3);
+  BOOST_REQUIRE(tag1 != nullptr);
+  BOOST_CHECK_EQUAL(*tag1, 3);
+  BOOST_CHECK_EQUAL(makeHopCountTag(3), tag1);
+  BOOST_CHECK_NE(makeHopCountTag(4), tag1);
+
+  shared_ptr<lp::HopCountTag> tag2 = makeHopCountTag(N_SHARED_TAG_VALUES);
+  BOOST_REQUIRE(tag2 != nullptr);
+  BOOST_CHECK_EQUAL(*tag2, N_SHARED_TAG_VALUES);
+  BOOST_CHECK_NE(makeHopCountTag(N_SHARED_TAG_VALUES), tag2);
+}
+
+BOOST_AUTO_TEST_CASE(CongestionMark)
+{
+  shared_ptr<lp::CongestionMarkTag> tag1 = makeCongestionMarkTag(1);
+  BOOST_REQUIRE(tag1 != nullptr);
+  BOOST_CHECK_EQUAL(*tag1, 1);
+  BOOST_CHECK_EQUAL(makeCongestionMarkTag(1), tag1);
+
+  shared_ptr<lp::CongestionMarkTag> tag2 = makeCongestionMarkTag(1 << 20);
+  BOOST_REQUIRE(tag2 != nullptr);
+  BOOST_CHECK_EQUAL(*tag2, 1 << 20);
+}
+
+BOOST_AUTO_TEST_CASE(SharedAmongPackets)
+{
+  Interest interest1("/A");
+  Interest interest2("/B");
+  interest1.setTag(makeHopCountTag(1));
+  interest2.setTag(makeHopCountTag(1));
+  BOOST_CHECK_EQUAL(interest1.getTag<lp::HopCountTag>(), interest2.getTag<lp::HopCountTag>());
+
+  // removing a shared tag from one packet does not affect another
+  interest1.removeTag<lp::HopCountTag>();
+  BOOST_CHECK(interest1.getTag<lp::HopCountTag>() == nullptr);
+  BOOST_REQUIRE(interest2.getTag<lp::HopCountTag>() != nullptr);
+  BOOST_CHECK_EQUAL(*interest2.getTag<lp::HopCountTag>(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLpTags
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -167,6 +167,13 @@ BOOST_AUTO_TEST_CASE(Nonce)
                     DUPLICATE_NONCE_OUT_SAME | DUPLICATE_NONCE_OUT_OTHER);
   BOOST_CHECK_EQUAL(findDuplicateNonce(entry5, 19004, *face1), DUPLICATE_NONCE_NONE);
   BOOST_CHECK_EQUAL(findDuplicateNonce(entry5, 19004, *face2), DUPLICATE_NONCE_NONE);
+
+  // 29655 has the same nonce fingerprint as 25559, so the records are examined
+  pit::Entry entry6(*interest);
+  entry6.insertOrUpdateInRecord(*face1, *interest);
+  BOOST_REQUIRE_EQUAL(entry6.mayHaveNonce(29655), true);
+  BOOST_CHECK_EQUAL(findDuplicateNonce(entry6, 29655, *face1), DUPLICATE_NONCE_NONE);
+  BOOST_CHECK_EQUAL(findDuplicateNonce(entry6, 29655, *face2), DUPLICATE_NONCE_NONE);
 }
 
 BOOST_FIXTURE_TEST_CASE(HasPendingOutRecords, UnitTestTimeFixture)
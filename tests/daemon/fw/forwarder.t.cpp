@@ -81,6 +81,39 @@ BOOST_AUTO_TEST_CASE(SimpleExchange)
   BOOST_CHECK_EQUAL(forwarder.getCounters().nOutData, 1);
 }
 
+BOOST_AUTO_TEST_CASE(BatchExchange)
+{
+  Forwarder forwarder;
+
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.getFib().insert("/A").first->addOrUpdateNextHop(*face2, 0, 0);
+
+  face1->getLinkService()->beginReceiveBatch();
+  face1->receiveInterest(*makeInterest("/A/1", 7431));
+  face1->receiveInterest(*makeInterest("/A/2", 8264));
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 0);
+  face1->getLinkService()->endReceiveBatch();
+
+  // packets are processed in arrival order
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 2);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(face2->sentInterests[0].getName(), "/A/1");
+  BOOST_CHECK_EQUAL(face2->sentInterests[1].getName(), "/A/2");
+
+  face2->getLinkService()->beginReceiveBatch();
+  face2->receiveData(*makeData("/A/2"));
+  face2->receiveData(*makeData("/A/1"));
+  face2->getLinkService()->endReceiveBatch();
+
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInData, 2);
+  BOOST_REQUIRE_EQUAL(face1->sentData.size(), 2);
+  BOOST_CHECK_EQUAL(face1->sentData[0].getName(), "/A/2");
+  BOOST_CHECK_EQUAL(face1->sentData[1].getName(), "/A/1");
+}
+
 BOOST_AUTO_TEST_CASE(CsMatched)
 {
   Forwarder forwarder;
@@ -125,6 +158,150 @@ BOOST_AUTO_TEST_CASE(CsMatched)
   BOOST_CHECK_EQUAL(pit.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(CsSharesIncomingData)
+{
+  Forwarder forwarder;
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.getFib().insert("/A").first->addOrUpdateNextHop(*face2, 0, 0);
+
+  face1->receiveInterest(*makeInterest("/A", 1379));
+  this->advanceClocks(1_ms, 5_ms);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 1);
+
+  shared_ptr<Data> dataA = makeData("/A");
+  dataA->setTag(make_shared<lp::HopCountTag>(3));
+  face2->receiveData(*dataA);
+  this->advanceClocks(1_ms, 5_ms);
+
+  // forwarded Data keeps HopCountTag
+  BOOST_REQUIRE_EQUAL(face1->sentData.size(), 1);
+  BOOST_REQUIRE(face1->sentData[0].getTag<lp::HopCountTag>() != nullptr);
+  BOOST_CHECK_EQUAL(*face1->sentData[0].getTag<lp::HopCountTag>(), 3);
+
+  // CS stores the incoming Data packet itself, not a copy
+  Cs& cs = forwarder.getCs();
+  BOOST_REQUIRE_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(&cs.begin()->getData(), dataA.get());
+
+  // Data served from CS does not carry HopCountTag
+  face1->receiveInterest(*makeInterest("/A", 2468));
+  this->advanceClocks(1_ms, 5_ms);
+  BOOST_REQUIRE_EQUAL(face1->sentData.size(), 2);
+  BOOST_CHECK(face1->sentData[1].getTag<lp::HopCountTag>() == nullptr);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nCsHits, 1);
+}
+
+BOOST_AUTO_TEST_CASE(CsDeferredHit)
+{
+  Forwarder forwarder;
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+  forwarder.getFib().insert("/A").first->addOrUpdateNextHop(*face3, 0, 0);
+
+  // an external tier that answers after 10ms
+  shared_ptr<Data> dataA = makeData("/A");
+  int nLookups = 0;
+  Cs& cs = forwarder.getCs();
+  cs.setAsyncLookup([&] (const Interest&, const Cs::HitCallback& hit, const Cs::MissCallback&) {
+    ++nLookups;
+    scheduler::schedule(10_ms, [=] { hit(*makeInterest("/A"), *dataA); });
+  });
+
+  face1->receiveInterest(*makeInterest("/A", 6461));
+  this->advanceClocks(1_ms, 5_ms);
+  BOOST_CHECK_EQUAL(forwarder.getPit().size(), 1);
+
+  // duplicate Interest is aggregated with the pending lookup
+  face2->receiveInterest(*makeInterest("/A", 3108));
+  this->advanceClocks(1_ms, 20_ms);
+
+  BOOST_CHECK_EQUAL(nLookups, 1);
+  BOOST_CHECK_EQUAL(face3->sentInterests.size(), 0);
+  BOOST_CHECK_EQUAL(face1->sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face2->sentData.size(), 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nCsHits, 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nCsMisses, 0);
+
+  // found Data is inserted into memory
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+
+  this->advanceClocks(100_ms, 1_s);
+  BOOST_CHECK_EQUAL(forwarder.getPit().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CsDeferredMiss)
+{
+  Forwarder forwarder;
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+  forwarder.getFib().insert("/A").first->addOrUpdateNextHop(*face3, 0, 0);
+
+  forwarder.getCs().setAsyncLookup(
+    [&] (const Interest& interest, const Cs::HitCallback&, const Cs::MissCallback& miss) {
+      auto interestCopy = make_shared<Interest>(interest);
+      scheduler::schedule(10_ms, [=] { miss(*interestCopy); });
+    });
+
+  face1->receiveInterest(*makeInterest("/A", 2957));
+  this->advanceClocks(1_ms, 5_ms);
+  face2->receiveInterest(*makeInterest("/A", 8180));
+  BOOST_CHECK_EQUAL(face3->sentInterests.size(), 0);
+
+  // the Interest is forwarded once, on behalf of both downstreams
+  this->advanceClocks(1_ms, 20_ms);
+  BOOST_CHECK_EQUAL(face3->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nCsMisses, 1);
+
+  face3->receiveData(*makeData("/A"));
+  this->advanceClocks(1_ms, 5_ms);
+  BOOST_CHECK_EQUAL(face1->sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face2->sentData.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(CsDeferredStraggler)
+{
+  Forwarder forwarder;
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+
+  // an external tier that never answers
+  int nLookups = 0;
+  forwarder.getCs().setAsyncLookup(
+    [&] (const Interest&, const Cs::HitCallback&, const Cs::MissCallback&) { ++nLookups; });
+
+  face1->receiveInterest(*makeInterest("/A", 4270));
+  BOOST_CHECK_EQUAL(nLookups, 1);
+
+  // Data satisfies the entry while the lookup is pending, and is cached in memory
+  face3->receiveData(*makeData("/A"));
+  BOOST_CHECK_EQUAL(face1->sentData.size(), 1);
+
+  // an Interest arriving before the satisfied entry is finalized is served from memory,
+  // instead of waiting for the lookup
+  face2->receiveInterest(*makeInterest("/A", 9135));
+  BOOST_CHECK_EQUAL(face2->sentData.size(), 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nCsHits, 1);
+  BOOST_CHECK_EQUAL(nLookups, 1);
+
+  this->advanceClocks(100_ms, 5_s);
+  BOOST_CHECK_EQUAL(forwarder.getPit().size(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(OutgoingInterest)
 {
   Forwarder forwarder;
@@ -335,6 +512,42 @@ BOOST_AUTO_TEST_CASE(IncomingData)
   BOOST_CHECK_EQUAL(face4->sentData.size(), 1);
 }
 
+BOOST_AUTO_TEST_CASE(IncomingDataMultiMatchRepeated)
+{
+  Forwarder forwarder;
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+
+  Pit& pit = forwarder.getPit();
+  for (const char* uri : {"ndn:/P/1", "ndn:/Q/1"}) {
+    Name prefix(uri);
+    shared_ptr<Interest> interestShort = makeInterest(prefix.getPrefix(1));
+    shared_ptr<pit::Entry> pitShort = pit.insert(*interestShort).first;
+    pitShort->insertOrUpdateInRecord(*face1, *interestShort);
+    pitShort->insertOrUpdateInRecord(*face2, *interestShort);
+    shared_ptr<Interest> interestLong = makeInterest(prefix);
+    shared_ptr<pit::Entry> pitLong = pit.insert(*interestLong).first;
+    pitLong->insertOrUpdateInRecord(*face2, *interestLong);
+    pitLong->insertOrUpdateInRecord(*face1, *interestLong);
+  }
+
+  // each Data matches two PIT entries with the same downstreams
+  forwarder.onIncomingData(*face3, *makeData("ndn:/P/1/x"));
+  BOOST_CHECK_EQUAL(face1->sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face2->sentData.size(), 1);
+
+  // downstreams marked by the previous Data are selected again
+  forwarder.onIncomingData(*face3, *makeData("ndn:/Q/1/x"));
+  BOOST_CHECK_EQUAL(face1->sentData.size(), 2);
+  BOOST_CHECK_EQUAL(face2->sentData.size(), 2);
+  BOOST_CHECK_EQUAL(face3->sentData.size(), 0);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nOutData, 4);
+}
+
 BOOST_AUTO_TEST_CASE(IncomingNack)
 {
   Forwarder forwarder;
@@ -0,0 +1,75 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/shard-selector.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestShardSelector, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Select)
+{
+  ShardSelector select(8, 2);
+  BOOST_CHECK_EQUAL(select.getNShards(), 8);
+  BOOST_CHECK_EQUAL(select.getPrefixLength(), 2);
+
+  // Names sharing the first two components are assigned to the same shard
+  size_t shard = select("/A/B");
+  BOOST_CHECK_LT(shard, 8);
+  BOOST_CHECK_EQUAL(select("/A/B/C"), shard);
+  BOOST_CHECK_EQUAL(select("/A/B/D/E"), shard);
+
+  // a shorter Name is assigned by all its components
+  BOOST_CHECK_EQUAL(select("/A"), name_tree::computeHash("/A") % 8);
+}
+
+BOOST_AUTO_TEST_CASE(Distribution)
+{
+  const size_t nShards = 4;
+  ShardSelector select(nShards, 1);
+
+  std::vector<size_t> counts(nShards);
+  for (size_t i = 0; i < 4000; ++i) {
+    ++counts.at(select(Name("/prefix" + to_string(i)).append("suffix")));
+  }
+  for (size_t count : counts) {
+    BOOST_CHECK_GT(count, 800);
+    BOOST_CHECK_LT(count, 1200);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestShardSelector
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
@@ -28,6 +28,7 @@
 #include "nfd-manager-common-fixture.hpp"
 
 #include <ndn-cxx/mgmt/nfd/cs-info.hpp>
+#include <boost/filesystem.hpp>
 
 namespace nfd {
 namespace tests {
@@ -198,11 +199,95 @@ BOOST_AUTO_TEST_CASE(Erase)
   BOOST_CHECK_EQUAL(m_cs.size(), 3);
 }
 
+BOOST_AUTO_TEST_CASE(EraseJob)
+{
+  m_cs.setLimit(Cs::ERASE_JOB_BATCH * 4);
+  for (size_t i = 0; i < Cs::ERASE_JOB_BATCH * 3; ++i) {
+    m_cs.insert(*makeData(Name("/E").appendSequenceNumber(i)));
+  }
+  m_cs.insert(*makeData("/F"));
+
+  // start a job
+  auto req = makeControlCommandRequest("/localhost/nfd/cs/erase-start",
+    ControlParameters().setName("/E"));
+  receiveInterest(req);
+  BOOST_CHECK_EQUAL(checkResponse(0, req.getName(),
+                                  ControlResponse(200, "OK").setBody(
+                                    ControlParameters().setName("/E").setCount(0).wireEncode())),
+                    CheckResponseResult::OK);
+
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK_EQUAL(m_cs.size(), 1);
+  BOOST_CHECK_EQUAL(m_cs.getEraseJobs().size(), 0);
+
+  // cancel a job that has completed
+  req = makeControlCommandRequest("/localhost/nfd/cs/erase-cancel",
+    ControlParameters().setName("/E"));
+  receiveInterest(req);
+  BOOST_CHECK_EQUAL(checkResponse(1, req.getName(),
+                                  ControlResponse(404, "No erase job for this prefix")),
+                    CheckResponseResult::OK);
+}
+
+BOOST_AUTO_TEST_CASE(EraseJobsDataset)
+{
+  const size_t nEntries = Cs::ERASE_JOB_BATCH * 50;
+  m_cs.setLimit(nEntries);
+  for (size_t i = 0; i < nEntries; ++i) {
+    m_cs.insert(*makeData(Name("/E").appendSequenceNumber(i)));
+  }
+  m_cs.startEraseJob("/E");
+
+  receiveInterest(Interest("/localhost/nfd/cs/erase-jobs").setCanBePrefix(true));
+  Block dataset = concatenateResponses();
+  dataset.parse();
+  BOOST_REQUIRE_EQUAL(dataset.elements_size(), 1);
+
+  // the job has erased a few batches while the dataset request was being processed
+  CsEraseJob job(*dataset.elements_begin());
+  BOOST_CHECK_EQUAL(job.getName(), "/E");
+  BOOST_CHECK_EQUAL(job.getNErased() % Cs::ERASE_JOB_BATCH, 0);
+  BOOST_CHECK_LT(job.getNErased(), nEntries);
+
+  BOOST_CHECK(m_cs.cancelEraseJob("/E"));
+  BOOST_CHECK_GT(m_cs.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Snapshot)
+{
+  // snapshot is not configured
+  auto req = makeControlCommandRequest("/localhost/nfd/cs/snapshot", ControlParameters());
+  receiveInterest(req);
+  BOOST_CHECK_EQUAL(checkResponse(0, req.getName(),
+                                  ControlResponse(409, "CS snapshot is not configured")),
+                    CheckResponseResult::OK);
+
+  boost::filesystem::path dir = boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "cs-manager-snapshot";
+  boost::filesystem::remove_all(dir);
+  boost::filesystem::create_directories(dir);
+  m_cs.setSnapshotPath(dir / "cs.snapshot");
+  m_cs.insert(*makeData("/A"));
+  m_cs.insert(*makeData("/B"));
+
+  req = makeControlCommandRequest("/localhost/nfd/cs/snapshot", ControlParameters());
+  receiveInterest(req);
+  BOOST_CHECK_EQUAL(checkResponse(1, req.getName(),
+                                  ControlResponse(200, "OK").setBody(
+                                    ControlParameters().setCount(2).wireEncode())),
+                    CheckResponseResult::OK);
+  BOOST_CHECK(boost::filesystem::exists(dir / "cs.snapshot"));
+  boost::filesystem::remove_all(dir);
+}
+
 BOOST_AUTO_TEST_CASE(Info)
 {
   m_cs.setLimit(2681);
+  m_cs.setByteLimit(1048576);
+  size_t nBytes = 0;
   for (uint64_t i = 0; i < 310; ++i) {
-    m_cs.insert(*makeData(Name("/Q8H4oi4g").appendSequenceNumber(i)));
+    auto data = makeData(Name("/Q8H4oi4g").appendSequenceNumber(i));
+    nBytes += data->wireEncode().size();
+    m_cs.insert(*data);
   }
   m_cs.enableAdmit(false);
   m_cs.enableServe(true);
@@ -221,6 +306,15 @@ BOOST_AUTO_TEST_CASE(Info)
   BOOST_CHECK_EQUAL(info.getNEntries(), 310);
   BOOST_CHECK_EQUAL(info.getNHits(), 362);
   BOOST_CHECK_EQUAL(info.getNMisses(), 1493);
+
+  Block infoBlock = *dataset.elements_begin();
+  infoBlock.parse();
+  BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(infoBlock.get(CsManager::TLV_CS_N_BYTES)), nBytes);
+  BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(infoBlock.get(CsManager::TLV_CS_MAX_BYTES)), 1048576);
+  BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(
+                      infoBlock.get(CsManager::TLV_CS_N_MISS_FILTER_HITS)), 0);
+  BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(
+                      infoBlock.get(CsManager::TLV_CS_N_MISS_FILTER_FALSE_POSITIVES)), 0);
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestCsManager
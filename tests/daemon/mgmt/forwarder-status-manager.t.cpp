@@ -24,9 +24,11 @@
  */
 
 #include "mgmt/forwarder-status-manager.hpp"
+#include "core/latency-tlv.hpp"
 #include "core/version.hpp"
 
 #include "nfd-manager-common-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
 
 namespace nfd {
 namespace tests {
@@ -107,6 +109,82 @@ BOOST_AUTO_TEST_CASE(GeneralStatusDataset)
   BOOST_CHECK_EQUAL(status.getNUnsatisfiedInterests(), m_forwarder.getCounters().nUnsatisfiedInterests);
 }
 
+BOOST_AUTO_TEST_CASE(LatencyDataset)
+{
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  m_forwarder.addFace(face1);
+  m_forwarder.addFace(face2);
+  m_forwarder.getFib().insert("/A").first->addOrUpdateNextHop(*face2, 0, 0);
+
+  for (uint64_t i = 0; i < 40; ++i) {
+    face1->receiveInterest(*makeInterest(Name("/A").appendSequenceNumber(i)));
+  }
+  for (uint64_t i = 0; i < 40; ++i) {
+    face2->receiveData(*makeData(Name("/A").appendSequenceNumber(i)));
+  }
+
+  receiveInterest(Interest("/localhost/nfd/status/latency").setCanBePrefix(true));
+  Block dataset = concatenateResponses();
+  dataset.parse();
+  BOOST_REQUIRE_EQUAL(dataset.elements_size(), 6);
+
+  const ForwarderCounters& counters = m_forwarder.getCounters();
+  const LatencyHistogram* histograms[] = {
+    &counters.inInterestLatency,
+    &counters.csLookupLatency,
+    &counters.strategyLatency,
+    &counters.outInterestLatency,
+    &counters.inDataLatency,
+    &counters.pitMatchLatency,
+  };
+  const std::string stageNames[] = {
+    "incoming-interest",
+    "cs-lookup",
+    "strategy-after-receive-interest",
+    "outgoing-interest",
+    "incoming-data",
+    "pit-match",
+  };
+
+  size_t i = 0;
+  for (Block stage : dataset.elements()) {
+    BOOST_TEST_CONTEXT("stage " << stageNames[i]) {
+      BOOST_CHECK_EQUAL(stage.type(), latency_tlv::PipelineStageLatency);
+      stage.parse();
+      BOOST_CHECK_EQUAL(ndn::encoding::readString(stage.get(latency_tlv::StageName)),
+                        stageNames[i]);
+      BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(
+                          stage.get(latency_tlv::NSamples)),
+                        histograms[i]->getCount());
+      BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(
+                          stage.get(latency_tlv::TotalNanoseconds)),
+                        histograms[i]->getTotal());
+
+      uint64_t nSamples = 0;
+      size_t nBuckets = 0;
+      for (const Block& element : stage.elements()) {
+        if (element.type() == latency_tlv::BucketCount) {
+          BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(element),
+                            histograms[i]->getBuckets().at(nBuckets));
+          nSamples += ndn::encoding::readNonNegativeInteger(element);
+          ++nBuckets;
+        }
+      }
+      BOOST_CHECK_EQUAL(nSamples, histograms[i]->getCount());
+    }
+    ++i;
+  }
+
+#ifndef DISABLE_LATENCY_HISTOGRAMS
+  // one in LatencyHistogram::SAMPLE_INTERVAL invocations is sampled, starting from the first
+  BOOST_CHECK_EQUAL(counters.inInterestLatency.getCount(), 3);
+  BOOST_CHECK_EQUAL(counters.outInterestLatency.getCount(), 3);
+  BOOST_CHECK_EQUAL(counters.inDataLatency.getCount(), 3);
+  BOOST_CHECK_EQUAL(counters.pitMatchLatency.getCount(), 3);
+#endif // DISABLE_LATENCY_HISTOGRAMS
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestForwarderStatusManager
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
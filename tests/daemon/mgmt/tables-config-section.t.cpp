@@ -32,6 +32,10 @@
 #include "tests/check-typeid.hpp"
 #include "../fw/dummy-strategy.hpp"
 
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
 namespace nfd {
 namespace tests {
 
@@ -152,6 +156,59 @@ BOOST_AUTO_TEST_CASE(InvalidValue)
 
 BOOST_AUTO_TEST_SUITE_END() // CsMaxPackets
 
+BOOST_AUTO_TEST_SUITE(CsMaxBytes)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  cs.setByteLimit(4096);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), 4096);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), std::numeric_limits<size_t>::max());
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_max_bytes 1048576
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_NE(cs.getByteLimit(), 1048576);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), 1048576);
+
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), 1048576);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_max_bytes invalid
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsMaxBytes
+
 BOOST_AUTO_TEST_SUITE(CsPolicy)
 
 BOOST_AUTO_TEST_CASE(Default)
@@ -200,6 +257,142 @@ BOOST_AUTO_TEST_CASE(Unknown)
 
 BOOST_AUTO_TEST_SUITE_END() // CsPolicy
 
+BOOST_AUTO_TEST_SUITE(CsDisk)
+
+BOOST_AUTO_TEST_CASE(EnableDisable)
+{
+  boost::filesystem::path dir = boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "tables-cs-disk";
+  boost::filesystem::remove_all(dir);
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_disk
+      {
+        path )CONFIG" + dir.string() + R"CONFIG(
+        max_bytes 16777216
+      }
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, true);
+  BOOST_CHECK(cs.getDiskTier() == nullptr);
+
+  runConfig(CONFIG, false);
+  BOOST_REQUIRE(cs.getDiskTier() != nullptr);
+  BOOST_CHECK_EQUAL(cs.getDiskTier()->getPath(), dir);
+  BOOST_CHECK_EQUAL(cs.getDiskTier()->getMaxBytes(), 16777216);
+
+  // unchanged configuration keeps the disk tier
+  const cs::DiskTier* diskTier = cs.getDiskTier();
+  runConfig(CONFIG, false);
+  BOOST_CHECK(cs.getDiskTier() == diskTier);
+
+  runConfig("tables\n{\n}\n", false);
+  BOOST_CHECK(cs.getDiskTier() == nullptr);
+  boost::filesystem::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_CASE(MissingValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_disk
+      {
+        max_bytes 16777216
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(BadPath)
+{
+  boost::filesystem::path dir = boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "tables-cs-disk";
+  boost::filesystem::remove_all(dir);
+  boost::filesystem::create_directories(dir);
+  boost::filesystem::path file = dir / "file";
+  std::ofstream(file.string()) << "file\n";
+
+  auto makeConfig = [] (const boost::filesystem::path& path) {
+    return R"CONFIG(
+      tables
+      {
+        cs_disk
+        {
+          path )CONFIG" + path.string() + R"CONFIG(
+          max_bytes 16777216
+        }
+      }
+    )CONFIG";
+  };
+
+  runConfig(makeConfig(dir / "good"), false);
+  const cs::DiskTier* diskTier = cs.getDiskTier();
+  BOOST_REQUIRE(diskTier != nullptr);
+
+  // a directory cannot be created under a regular file
+  const std::string BAD_CONFIG = makeConfig(file / "bad");
+  BOOST_CHECK_THROW(runConfig(BAD_CONFIG, true), ConfigFile::Error);
+
+  // a failed reload keeps the old disk tier
+  BOOST_CHECK_THROW(runConfig(BAD_CONFIG, false), ConfigFile::Error);
+  BOOST_CHECK(cs.getDiskTier() == diskTier);
+
+  cs.setDiskTier(nullptr);
+  boost::filesystem::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsDisk
+
+BOOST_AUTO_TEST_SUITE(FibPrefixLengthSearch)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  forwarder.getFib().enablePrefixLengthSearch(true);
+  runConfig("tables\n{\n}\n", true);
+  BOOST_CHECK_EQUAL(forwarder.getFib().isPrefixLengthSearchEnabled(), true);
+
+  runConfig("tables\n{\n}\n", false);
+  BOOST_CHECK_EQUAL(forwarder.getFib().isPrefixLengthSearchEnabled(), false);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      fib_prefix_length_search yes
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, true);
+  BOOST_CHECK_EQUAL(forwarder.getFib().isPrefixLengthSearchEnabled(), false);
+
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(forwarder.getFib().isPrefixLengthSearchEnabled(), true);
+
+  fib::Entry* entry = forwarder.getFib().insert("/A/B").first;
+  BOOST_CHECK_EQUAL(&forwarder.getFib().findLongestPrefixMatch("/A/B/C/D"), entry);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      fib_prefix_length_search maybe
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // FibPrefixLengthSearch
+
 class CsUnsolicitedPolicyFixture : public TablesConfigSectionFixture
 {
 protected:
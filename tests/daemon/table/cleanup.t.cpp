@@ -64,9 +64,11 @@ BOOST_AUTO_TEST_CASE(Basic)
   BOOST_CHECK_EQUAL(fib.size(), 300);
   BOOST_CHECK_EQUAL(pit.size(), 300);
 
-  cleanupOnFaceRemoval(nameTree, fib, pit, *face1);
+  CleanupResult cleaned = cleanupOnFaceRemoval(nameTree, fib, pit, *face1);
   BOOST_CHECK_EQUAL(fib.size(), 0);
   BOOST_CHECK_EQUAL(pit.size(), 300);
+  BOOST_CHECK_EQUAL(cleaned.nFibEntries, 300);
+  BOOST_CHECK_EQUAL(cleaned.nPitEntries, 225);
   for (const pit::Entry& pitEntry : pit) {
     BOOST_CHECK_EQUAL(pitEntry.hasInRecords(), false);
     BOOST_CHECK_EQUAL(pitEntry.hasOutRecords(), false);
@@ -114,6 +116,7 @@ BOOST_AUTO_TEST_CASE(RemoveFibNexthops)
   BOOST_CHECK_EQUAL(face1->getState(), face::FaceState::CLOSED);
   // {'/A':[2], '/C':[2]}
   BOOST_CHECK_EQUAL(fib.size(), 2);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nCleanedFibEntries, 4);
 
   const fib::Entry& foundA = fib.findLongestPrefixMatch("/A");
   BOOST_CHECK_EQUAL(foundA.getPrefix(), "/A");
@@ -127,6 +130,7 @@ BOOST_AUTO_TEST_CASE(RemoveFibNexthops)
   BOOST_CHECK_EQUAL(face2->getState(), face::FaceState::CLOSED);
   BOOST_CHECK_EQUAL(fib.size(), 0);
   BOOST_CHECK_EQUAL(nameTree.size(), nNameTreeEntriesBefore);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nCleanedFibEntries, 6);
 }
 
 BOOST_AUTO_TEST_CASE(DeletePitInOutRecords)
@@ -168,6 +172,7 @@ BOOST_AUTO_TEST_CASE(DeletePitInOutRecords)
   BOOST_CHECK_EQUAL(face1->getState(), face::FaceState::CLOSED);
   // {'/A':[2], '/B':[], '/C':[2]}
   BOOST_CHECK_EQUAL(pit.size(), 3);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nCleanedPitEntries, 2);
 
   shared_ptr<pit::Entry> foundA = pit.find(*interestA);
   BOOST_REQUIRE(foundA != nullptr);
@@ -177,6 +182,60 @@ BOOST_AUTO_TEST_CASE(DeletePitInOutRecords)
   BOOST_CHECK_EQUAL(&foundA->getOutRecords().front().getFace(), face2.get());
 }
 
+BOOST_AUTO_TEST_CASE(TableReferences)
+{
+  NameTree nameTree(16);
+  Fib fib(nameTree);
+  Pit pit(nameTree);
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+  face::TableReferences& refs1 = face1->getTableReferences();
+  face::TableReferences& refs2 = face2->getTableReferences();
+
+  fib::Entry* entryA = fib.insert("/A").first;
+  entryA->addOrUpdateNextHop(*face1, 0, 0);
+  entryA->addOrUpdateNextHop(*face1, 1, 0);
+  entryA->addOrUpdateNextHop(*face2, 0, 0);
+  fib::Entry* entryB = fib.insert("/B/1/2").first;
+  entryB->addOrUpdateNextHop(*face2, 0, 0);
+  BOOST_CHECK_EQUAL(std::distance(refs1.fib.begin(), refs1.fib.end()), 1);
+  BOOST_CHECK_EQUAL(std::distance(refs2.fib.begin(), refs2.fib.end()), 2);
+
+  entryA->removeNextHop(*face1, 0);
+  BOOST_CHECK_EQUAL(std::distance(refs1.fib.begin(), refs1.fib.end()), 1);
+  entryA->removeNextHop(*face1, 1);
+  BOOST_CHECK(refs1.fib.empty());
+  entryA->addOrUpdateNextHop(*face1, 0, 0);
+
+  shared_ptr<Interest> interestC = makeInterest("/C");
+  shared_ptr<pit::Entry> entryC = pit.insert(*interestC).first;
+  entryC->insertOrUpdateInRecord(*face1, *interestC);
+  entryC->insertOrUpdateInRecord(*face1, *interestC);
+  entryC->insertOrUpdateOutRecord(*face2, *interestC);
+  BOOST_CHECK_EQUAL(std::distance(refs1.pit.begin(), refs1.pit.end()), 1);
+  BOOST_CHECK_EQUAL(std::distance(refs2.pit.begin(), refs2.pit.end()), 1);
+  entryC->deleteOutRecord(*face2);
+  BOOST_CHECK(refs2.pit.empty());
+  entryC->insertOrUpdateOutRecord(*face2, *interestC);
+
+  CleanupResult cleaned = cleanupOnFaceRemoval(nameTree, fib, pit, *face2);
+  BOOST_CHECK(refs2.fib.empty());
+  BOOST_CHECK(refs2.pit.empty());
+  BOOST_CHECK_EQUAL(cleaned.nFibEntries, 2);
+  BOOST_CHECK_EQUAL(cleaned.nPitEntries, 1);
+  BOOST_CHECK_EQUAL(fib.size(), 1);
+  BOOST_CHECK(nameTree.findExactMatch("/B") == nullptr);
+  BOOST_CHECK_EQUAL(entryA->getNextHops().size(), 1);
+  BOOST_CHECK_EQUAL(entryC->getInRecords().size(), 1);
+  BOOST_CHECK_EQUAL(entryC->hasOutRecords(), false);
+
+  // erasing the PIT entry unlinks its records
+  pit.erase(entryC.get());
+  entryC.reset();
+  BOOST_CHECK(refs1.pit.empty());
+  BOOST_CHECK_EQUAL(std::distance(refs1.fib.begin(), refs1.fib.end()), 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // FaceRemovalCleanup
 
 BOOST_AUTO_TEST_SUITE_END() // TestCleanup
@@ -0,0 +1,311 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-disk-tier.hpp"
+#include "table/cs.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <csignal>
+#include <sys/resource.h>
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+using namespace nfd::tests;
+
+class DiskTierFixture : public UnitTestTimeFixture
+{
+protected:
+  DiskTierFixture()
+    : dir(boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "cs-disk-tier")
+  {
+    boost::filesystem::remove_all(dir);
+  }
+
+  ~DiskTierFixture()
+  {
+    boost::filesystem::remove_all(dir);
+  }
+
+  static shared_ptr<Data>
+  makeBigData(const Name& name, size_t contentSize)
+  {
+    auto data = make_shared<Data>(name);
+    std::vector<uint8_t> content(contentSize, 0xBB);
+    data->setContent(content.data(), content.size());
+    return signData(data);
+  }
+
+  shared_ptr<Data>
+  find(const DiskTier& diskTier, const Interest& interest)
+  {
+    time::system_clock::TimePoint staleTime;
+    return diskTier.find(interest, staleTime);
+  }
+
+protected:
+  boost::filesystem::path dir;
+};
+
+/** \brief limits the size of files written by this process, to simulate a full filesystem
+ */
+class FileSizeLimit : noncopyable
+{
+public:
+  explicit
+  FileSizeLimit(rlim_t limit)
+  {
+    // exceeding the limit fails with EFBIG instead of killing the process
+    m_oldHandler = std::signal(SIGXFSZ, SIG_IGN);
+    ::getrlimit(RLIMIT_FSIZE, &m_oldLimit);
+    struct rlimit newLimit = m_oldLimit;
+    newLimit.rlim_cur = limit;
+    ::setrlimit(RLIMIT_FSIZE, &newLimit);
+  }
+
+  ~FileSizeLimit()
+  {
+    ::setrlimit(RLIMIT_FSIZE, &m_oldLimit);
+    std::signal(SIGXFSZ, m_oldHandler);
+  }
+
+private:
+  struct rlimit m_oldLimit;
+  void (*m_oldHandler)(int);
+};
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestCsDiskTier, DiskTierFixture)
+
+BOOST_AUTO_TEST_CASE(InsertFind)
+{
+  DiskTier diskTier(dir, 16 << 20);
+  BOOST_CHECK_EQUAL(diskTier.size(), 0);
+
+  shared_ptr<Data> dataA = makeData("/A/1");
+  shared_ptr<Data> dataB = makeData("/B/1");
+  diskTier.insert(*dataA, time::system_clock::now() + 1_s);
+  diskTier.insert(*dataB, time::system_clock::now() + 1_s);
+  diskTier.insert(*dataA, time::system_clock::now() + 1_s);
+  BOOST_CHECK_EQUAL(diskTier.size(), 2);
+
+  shared_ptr<Data> found = this->find(diskTier, Interest("/A/1"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->wireEncode(), dataA->wireEncode());
+
+  found = this->find(diskTier, Interest(dataB->getFullName()));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), "/B/1");
+
+  BOOST_CHECK(this->find(diskTier, Interest("/A")) == nullptr);
+  found = this->find(diskTier, Interest("/A").setCanBePrefix(true));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), "/A/1");
+
+  BOOST_CHECK(this->find(diskTier, Interest("/A/1").setMustBeFresh(true)) != nullptr);
+  advanceClocks(500_ms, 4);
+  BOOST_CHECK(this->find(diskTier, Interest("/A/1").setMustBeFresh(true)) == nullptr);
+  BOOST_CHECK(this->find(diskTier, Interest("/A/1")) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Reopen)
+{
+  shared_ptr<Data> dataA = makeData("/A/1");
+  {
+    DiskTier diskTier(dir, 16 << 20);
+    diskTier.insert(*dataA, time::system_clock::now() + 10_s);
+    diskTier.insert(*makeData("/A/2"), time::system_clock::now() + 10_s);
+    diskTier.insert(*makeData("/B/1"), time::system_clock::now() + 10_s);
+    BOOST_CHECK_EQUAL(diskTier.erase("/B", 10), 1);
+    BOOST_CHECK_EQUAL(diskTier.size(), 2);
+  }
+
+  DiskTier diskTier(dir, 16 << 20);
+  BOOST_CHECK_EQUAL(diskTier.size(), 2);
+  BOOST_CHECK(this->find(diskTier, Interest("/B/1")) == nullptr);
+
+  time::system_clock::TimePoint staleTime;
+  shared_ptr<Data> found = diskTier.find(Interest("/A/1").setMustBeFresh(true), staleTime);
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->wireEncode(), dataA->wireEncode());
+  BOOST_CHECK(staleTime > time::system_clock::now());
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  DiskTier diskTier(dir, 16 << 20);
+  diskTier.insert(*makeData("/A/1"), time::system_clock::now());
+  diskTier.insert(*makeData("/A/2"), time::system_clock::now());
+  diskTier.insert(*makeData("/A/3"), time::system_clock::now());
+  diskTier.insert(*makeData("/B/1"), time::system_clock::now());
+
+  BOOST_CHECK_EQUAL(diskTier.erase("/A", 2), 2);
+  BOOST_CHECK_EQUAL(diskTier.size(), 2);
+  BOOST_CHECK_EQUAL(diskTier.erase("/A", 2), 1);
+  BOOST_CHECK_EQUAL(diskTier.erase("/A", 2), 0);
+  BOOST_CHECK_EQUAL(diskTier.size(), 1);
+  BOOST_CHECK(this->find(diskTier, Interest("/B/1")) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(DropOldestSegment)
+{
+  DiskTier diskTier(dir, 2 * DiskTier::MIN_SEGMENT_SIZE);
+
+  const size_t contentSize = DiskTier::MIN_SEGMENT_SIZE / 10;
+  for (int i = 0; i < 30; ++i) {
+    diskTier.insert(*makeBigData(Name("/A").appendNumber(i), contentSize), time::system_clock::now());
+    BOOST_CHECK_LE(diskTier.getBytes(), diskTier.getMaxBytes());
+  }
+
+  BOOST_CHECK(this->find(diskTier, Interest(Name("/A").appendNumber(0))) == nullptr);
+  BOOST_CHECK(this->find(diskTier, Interest(Name("/A").appendNumber(29))) != nullptr);
+  BOOST_CHECK_LT(diskTier.size(), 30);
+
+  // a Data packet larger than a segment is not stored
+  diskTier.insert(*makeBigData("/B", DiskTier::MIN_SEGMENT_SIZE), time::system_clock::now());
+  BOOST_CHECK(this->find(diskTier, Interest("/B")) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(CsDemotePromote)
+{
+  Cs cs(2);
+  cs.setDiskTier(make_unique<DiskTier>(dir, 16 << 20));
+
+  cs.insert(*makeData("/A"));
+  cs.insert(*makeData("/B"));
+  cs.insert(*makeData("/C")); // evicts A to disk tier
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.getDiskTier()->size(), 1);
+
+  bool isHit = false;
+  cs.find(Interest("/A"),
+          [&] (const Interest&, const Data& data) {
+            isHit = true;
+            BOOST_CHECK_EQUAL(data.getName(), "/A");
+          },
+          bind([] { BOOST_CHECK(false); }));
+  BOOST_CHECK(isHit);
+
+  // A is promoted into memory, evicting B to disk tier
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.getDiskTier()->size(), 2);
+
+  size_t nErased = 0;
+  cs.erase("/", 10, [&] (size_t n) { nErased = n; });
+  BOOST_CHECK_EQUAL(nErased, 4);
+  BOOST_CHECK_EQUAL(cs.size(), 0);
+  BOOST_CHECK_EQUAL(cs.getDiskTier()->size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(DiskFull)
+{
+  DiskTier diskTier(dir, 16 << 20);
+
+  // checks are deferred until the limit is lifted, so that test output can be written
+  bool hasError = false;
+  {
+    FileSizeLimit limit(DiskTier::MIN_SEGMENT_SIZE / 2);
+    try {
+      diskTier.insert(*makeData("/A"), time::system_clock::now());
+    }
+    catch (const DiskTier::Error&) {
+      hasError = true;
+    }
+  }
+  BOOST_CHECK(hasError);
+  BOOST_CHECK_EQUAL(diskTier.size(), 0);
+  BOOST_CHECK_EQUAL(diskTier.getBytes(), 0);
+  BOOST_CHECK(boost::filesystem::is_empty(dir));
+
+  diskTier.insert(*makeData("/A"), time::system_clock::now());
+  BOOST_CHECK_EQUAL(diskTier.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(EraseDiskFull)
+{
+  DiskTier diskTier(dir, DiskTier::N_SEGMENTS * DiskTier::MIN_SEGMENT_SIZE);
+  for (int i = 0; i < 9; ++i) {
+    diskTier.insert(*makeBigData(Name("/B").appendNumber(i), DiskTier::MIN_SEGMENT_SIZE / 10),
+                    time::system_clock::now());
+  }
+  BOOST_REQUIRE_EQUAL(diskTier.getBytes(), DiskTier::MIN_SEGMENT_SIZE);
+
+  // fill the only segment, then erase more Names than there is room for tombstones
+  bool hasError = false;
+  size_t nErased = 0;
+  {
+    FileSizeLimit limit(DiskTier::MIN_SEGMENT_SIZE / 2);
+    for (int i = 0; !hasError; ++i) {
+      try {
+        diskTier.insert(*makeData(Name("/A").appendNumber(i)), time::system_clock::now());
+      }
+      catch (const DiskTier::Error&) {
+        hasError = true;
+      }
+    }
+    nErased = diskTier.erase("/A", std::numeric_limits<size_t>::max());
+  }
+  BOOST_CHECK(hasError);
+  size_t nA = diskTier.size() - 9 + nErased;
+  BOOST_CHECK_LT(nErased, nA);
+  BOOST_CHECK_EQUAL(diskTier.getBytes(), DiskTier::MIN_SEGMENT_SIZE);
+
+  // Names without a tombstone stay in the index, as they would when the log is reloaded
+  {
+    DiskTier reopened(dir, diskTier.getMaxBytes());
+    BOOST_CHECK_EQUAL(reopened.size(), diskTier.size());
+  }
+
+  BOOST_CHECK_EQUAL(diskTier.erase("/A", std::numeric_limits<size_t>::max()), nA - nErased);
+  BOOST_CHECK_EQUAL(diskTier.size(), 9);
+}
+
+BOOST_AUTO_TEST_CASE(CsDemoteDiskFull)
+{
+  Cs cs(1);
+  cs.setDiskTier(make_unique<DiskTier>(dir, 16 << 20));
+
+  cs.insert(*makeData("/A"));
+  {
+    FileSizeLimit limit(DiskTier::MIN_SEGMENT_SIZE / 2);
+    cs.insert(*makeData("/B")); // evicts A, which cannot be demoted
+  }
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.getDiskTier()->size(), 0);
+
+  cs.insert(*makeData("/C")); // evicts B to disk tier
+  BOOST_CHECK_EQUAL(cs.getDiskTier()->size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsDiskTier
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-miss-filter.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_AUTO_TEST_SUITE(TestCsMissFilter)
+
+BOOST_AUTO_TEST_CASE(AddContains)
+{
+  MissFilter filter(100);
+  BOOST_CHECK(filter.empty());
+  BOOST_CHECK(!filter.contains(name_tree::computeHash("/A")));
+
+  filter.add(name_tree::computeHash("/A"));
+  BOOST_CHECK_EQUAL(filter.size(), 1);
+  BOOST_CHECK(filter.contains(name_tree::computeHash("/A")));
+  BOOST_CHECK(filter.containsAny(name_tree::computeHashes("/A/B")));
+  BOOST_CHECK(!filter.containsAny(name_tree::computeHashes("/B")));
+
+  filter.clear();
+  BOOST_CHECK(filter.empty());
+  BOOST_CHECK(!filter.contains(name_tree::computeHash("/A")));
+}
+
+BOOST_AUTO_TEST_CASE(FalsePositiveRate)
+{
+  const size_t capacity = 1000;
+  MissFilter filter(capacity);
+  for (size_t i = 0; i < capacity; ++i) {
+    filter.add(name_tree::computeHash(Name("/A").appendNumber(i)));
+  }
+  for (size_t i = 0; i < capacity; ++i) {
+    BOOST_CHECK(filter.contains(name_tree::computeHash(Name("/A").appendNumber(i))));
+  }
+
+  size_t nFalsePositives = 0;
+  for (size_t i = 0; i < 10000; ++i) {
+    nFalsePositives += filter.contains(name_tree::computeHash(Name("/B").appendNumber(i)));
+  }
+  BOOST_CHECK_LT(nFalsePositives, 300);
+
+  // reaching the capacity clears the filter
+  filter.add(name_tree::computeHash("/C"));
+  BOOST_CHECK_EQUAL(filter.size(), 1);
+  BOOST_CHECK(filter.contains(name_tree::computeHash("/C")));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsMissFilter
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-policy-clock.hpp"
+#include "table/cs.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_AUTO_TEST_SUITE(TestCsClock)
+
+BOOST_AUTO_TEST_CASE(Registration)
+{
+  std::set<std::string> policyNames = Policy::getPolicyNames();
+  BOOST_CHECK_EQUAL(policyNames.count("clock"), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(EvictOne, UnitTestTimeFixture)
+{
+  Cs cs(3);
+  cs.setPolicy(make_unique<ClockPolicy>());
+
+  cs.insert(*makeData("ndn:/A"));
+  cs.insert(*makeData("ndn:/B"));
+  cs.insert(*makeData("ndn:/C"));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+
+  // evict A
+  cs.insert(*makeData("ndn:/D"));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  cs.find(Interest("ndn:/A"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+
+  // use B, so that B gets a second chance
+  cs.find(Interest("ndn:/B"),
+          bind([] { BOOST_CHECK(true); }),
+          bind([] { BOOST_CHECK(false); }));
+
+  // evict C
+  cs.insert(*makeData("ndn:/E"));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  cs.find(Interest("ndn:/C"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+
+  // evict D, which took the slot of A
+  cs.insert(*makeData("ndn:/F"));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  cs.find(Interest("ndn:/D"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+
+  // evict B, whose second chance has been used
+  cs.insert(*makeData("ndn:/G"));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  cs.find(Interest("ndn:/B"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+}
+
+BOOST_FIXTURE_TEST_CASE(EraseAndShrink, UnitTestTimeFixture)
+{
+  Cs cs(100);
+  cs.setPolicy(make_unique<ClockPolicy>());
+
+  for (int i = 0; i < 100; ++i) {
+    cs.insert(*makeData(Name("/A").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(cs.size(), 100);
+
+  size_t nErased = 0;
+  cs.erase("/A", 60, [&] (size_t n) { nErased = n; });
+  BOOST_CHECK_EQUAL(nErased, 60);
+  BOOST_CHECK_EQUAL(cs.size(), 40);
+
+  for (int i = 100; i < 300; ++i) {
+    cs.insert(*makeData(Name("/B").appendNumber(i)));
+    BOOST_CHECK_LE(cs.size(), 100);
+  }
+  BOOST_CHECK_EQUAL(cs.size(), 100);
+
+  cs.setLimit(10);
+  BOOST_CHECK_EQUAL(cs.size(), 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsClock
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
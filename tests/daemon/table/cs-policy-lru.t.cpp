@@ -90,6 +90,46 @@ BOOST_FIXTURE_TEST_CASE(EvictOne, UnitTestTimeFixture)
           bind([] { BOOST_CHECK(true); }));
 }
 
+BOOST_FIXTURE_TEST_CASE(EvictByBytes, UnitTestTimeFixture)
+{
+  Cs cs(100);
+  cs.setPolicy(make_unique<LruPolicy>());
+
+  auto makeSizedData = [] (const Name& name, size_t contentSize) {
+    auto data = make_shared<Data>(name);
+    std::vector<uint8_t> content(contentSize, 0xBB);
+    data->setContent(content.data(), content.size());
+    return signData(data);
+  };
+
+  auto dataA = makeSizedData("/A", 1000);
+  auto dataB = makeSizedData("/B", 1000);
+  auto dataC = makeSizedData("/C", 2000);
+  size_t sizeA = dataA->wireEncode().size();
+  size_t sizeB = dataB->wireEncode().size();
+  size_t sizeC = dataC->wireEncode().size();
+  cs.setByteLimit(sizeA + sizeB + 100);
+
+  cs.insert(*dataA);
+  cs.insert(*dataB);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.getBytes(), sizeA + sizeB);
+
+  // evict A and B
+  cs.insert(*dataC);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.getBytes(), sizeC);
+
+  // larger than byte limit, not admitted
+  cs.insert(*makeSizedData("/D", 3000));
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.getBytes(), sizeC);
+
+  cs.setByteLimit(sizeC - 1);
+  BOOST_CHECK_EQUAL(cs.size(), 0);
+  BOOST_CHECK_EQUAL(cs.getBytes(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCsLru
 BOOST_AUTO_TEST_SUITE_END() // Table
 
@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-policy-tinylfu.hpp"
+#include "table/cs.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_AUTO_TEST_SUITE(TestCsTinyLfu)
+
+BOOST_AUTO_TEST_CASE(Registration)
+{
+  std::set<std::string> policyNames = Policy::getPolicyNames();
+  BOOST_CHECK_EQUAL(policyNames.count("tinylfu"), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Sketch)
+{
+  tinylfu::FrequencySketch sketch;
+  sketch.resize(64);
+  BOOST_CHECK_EQUAL(sketch.estimate(1), 0);
+
+  for (int i = 0; i < 5; ++i) {
+    sketch.increment(1);
+  }
+  sketch.increment(2);
+  BOOST_CHECK_GE(sketch.estimate(1), 5);
+  BOOST_CHECK_GE(sketch.estimate(2), 1);
+  BOOST_CHECK_LT(sketch.estimate(2), sketch.estimate(1));
+
+  for (int i = 0; i < 100; ++i) {
+    sketch.increment(3);
+  }
+  BOOST_CHECK_LE(sketch.estimate(3), tinylfu::FrequencySketch::MAX_COUNT);
+}
+
+BOOST_AUTO_TEST_CASE(SketchAging)
+{
+  tinylfu::FrequencySketch sketch;
+  sketch.resize(1); // 16 counters per row, aging after 160 samples
+
+  for (int i = 0; i < 15; ++i) {
+    sketch.increment(1);
+  }
+  for (int i = 0; i < 5; ++i) {
+    sketch.increment(2);
+  }
+  BOOST_CHECK_EQUAL(sketch.estimate(1), tinylfu::FrequencySketch::MAX_COUNT);
+
+  for (int i = 0; i < 140; ++i) {
+    sketch.increment(3);
+  }
+
+  // all counters are halved, and no bit leaks between the two counters sharing an octet
+  BOOST_CHECK_EQUAL(sketch.estimate(1), 7);
+  for (size_t key = 0; key < 100; ++key) {
+    BOOST_CHECK_LE(sketch.estimate(key), 7);
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(Limit, UnitTestTimeFixture)
+{
+  Cs cs(10);
+  cs.setPolicy(make_unique<TinyLfuPolicy>());
+
+  for (int i = 0; i < 100; ++i) {
+    cs.insert(*makeData(Name("/A").appendNumber(i)));
+    BOOST_CHECK_LE(cs.size(), 10);
+  }
+  BOOST_CHECK_EQUAL(cs.size(), 10);
+
+  cs.setLimit(4);
+  BOOST_CHECK_EQUAL(cs.size(), 4);
+}
+
+BOOST_FIXTURE_TEST_CASE(ScanResistance, UnitTestTimeFixture)
+{
+  Cs cs(100);
+  cs.setPolicy(make_unique<TinyLfuPolicy>());
+
+  auto find = [&cs] (const Name& name) {
+    bool isHit = false;
+    cs.find(Interest(name).setCanBePrefix(false),
+            [&] (const Interest&, const Data&) { isHit = true; },
+            [] (const Interest&) {});
+    return isHit;
+  };
+
+  // popular working set
+  for (int i = 0; i < 50; ++i) {
+    cs.insert(*makeData(Name("/popular").appendNumber(i)));
+  }
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 50; ++i) {
+      BOOST_CHECK(find(Name("/popular").appendNumber(i)));
+    }
+  }
+
+  // one-time scan that is larger than the CS
+  for (int i = 0; i < 1000; ++i) {
+    cs.insert(*makeData(Name("/scan").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(cs.size(), 100);
+
+  int nPopularHits = 0;
+  for (int i = 0; i < 50; ++i) {
+    nPopularHits += static_cast<int>(find(Name("/popular").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(nPopularHits, 50);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsTinyLfu
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
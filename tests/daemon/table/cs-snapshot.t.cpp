@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-snapshot.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <fstream>
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+using namespace nfd::tests;
+
+class SnapshotFixture : public UnitTestTimeFixture
+{
+protected:
+  SnapshotFixture()
+    : path(boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "cs-snapshot" / "cs.snapshot")
+  {
+    boost::filesystem::remove_all(path.parent_path());
+    boost::filesystem::create_directories(path.parent_path());
+  }
+
+  ~SnapshotFixture()
+  {
+    boost::filesystem::remove_all(path.parent_path());
+  }
+
+  static bool
+  has(Cs& cs, const Name& name)
+  {
+    bool isHit = false;
+    cs.find(Interest(name),
+            [&] (const Interest&, const Data&) { isHit = true; },
+            [] (const Interest&) {});
+    return isHit;
+  }
+
+protected:
+  boost::filesystem::path path;
+};
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestCsSnapshot, SnapshotFixture)
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+  Cs cs(5);
+  for (const char* name : {"/A", "/B", "/C", "/D", "/E"}) {
+    cs.insert(*makeData(name), std::strcmp(name, "/C") == 0);
+  }
+  BOOST_CHECK(has(cs, "/A")); // eviction order becomes B C D E A
+  BOOST_CHECK_EQUAL(saveSnapshot(cs, path), 5);
+
+  // a smaller CS keeps entries that are the last to be evicted
+  Cs restored(4);
+  BOOST_CHECK_EQUAL(loadSnapshot(restored, path), 4);
+  BOOST_CHECK_EQUAL(restored.size(), 4);
+  BOOST_CHECK(!has(restored, "/B"));
+  BOOST_CHECK_EQUAL(restored.getBytes(), cs.getBytes() - makeData("/B")->wireEncode().size());
+
+  auto it = std::find_if(restored.begin(), restored.end(),
+                         [] (const Entry& entry) { return entry.getName() == "/C"; });
+  BOOST_REQUIRE(it != restored.end());
+  BOOST_CHECK(it->isUnsolicited());
+  BOOST_CHECK(!it->isStale());
+
+  // eviction order is restored: C is evicted first
+  restored.insert(*makeData("/F"));
+  BOOST_CHECK(!has(restored, "/C"));
+  BOOST_CHECK(has(restored, "/D"));
+  BOOST_CHECK(has(restored, "/A"));
+}
+
+BOOST_AUTO_TEST_CASE(StaleTime)
+{
+  Cs cs;
+  auto fresh = make_shared<Data>("/fresh");
+  fresh->setFreshnessPeriod(10_s);
+  cs.insert(*signData(fresh));
+  cs.insert(*makeData("/stale"));
+  saveSnapshot(cs, path);
+
+  advanceClocks(1_s);
+  Cs restored;
+  BOOST_CHECK_EQUAL(loadSnapshot(restored, path), 2);
+  for (const Entry& entry : restored) {
+    BOOST_CHECK_EQUAL(entry.isStale(), entry.getName() == "/stale");
+  }
+
+  advanceClocks(10_s);
+  for (const Entry& entry : restored) {
+    BOOST_CHECK(entry.isStale());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  Cs cs;
+  BOOST_CHECK_THROW(loadSnapshot(cs, path), SnapshotError);
+
+  {
+    std::ofstream os(path.string());
+    os << "not a snapshot";
+  }
+  BOOST_CHECK_THROW(loadSnapshot(cs, path), SnapshotError);
+
+  cs.insert(*makeData("/A"));
+  saveSnapshot(cs, path);
+  boost::filesystem::resize_file(path, boost::filesystem::file_size(path) - 1);
+  Cs restored;
+  BOOST_CHECK_THROW(loadSnapshot(restored, path), SnapshotError);
+  BOOST_CHECK_EQUAL(restored.size(), 0);
+
+  // record length follows the 8-octet magic; an oversized length is rejected before allocation
+  saveSnapshot(cs, path);
+  {
+    std::fstream fs(path.string(), std::ios::in | std::ios::out | std::ios::binary);
+    fs.seekp(8);
+    uint32_t length = 0xFFFFFFFF;
+    fs.write(reinterpret_cast<const char*>(&length), sizeof(length));
+  }
+  BOOST_CHECK_THROW(loadSnapshot(restored, path), SnapshotError);
+  BOOST_CHECK_EQUAL(restored.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsSnapshot
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
@@ -322,6 +322,57 @@ BOOST_AUTO_TEST_CASE(DigestOrder)
   CHECK_CS_FIND(expectedRightmost);
 }
 
+BOOST_AUTO_TEST_CASE(DigestOrderUnderPrefix)
+{
+  Name n1 = insert(1, "/A/B");
+  Name n2 = insert(2, "/A/B");
+  BOOST_CHECK_MESSAGE(n1 != n2, "implicit digest collision detected");
+  uint32_t expectedLeftmost = n1 < n2 ? 1 : 2;
+
+  // /A/B is a sub-namespace under /A, which is searched leftmost even if ChildSelector=1
+  startInterest("/A")
+    .setChildSelector(0);
+  CHECK_CS_FIND(expectedLeftmost);
+  startInterest("/A")
+    .setChildSelector(1);
+  CHECK_CS_FIND(expectedLeftmost);
+}
+
+BOOST_AUTO_TEST_CASE(CanBePrefixDigest)
+{
+  Name n1 = insert(1, "/A");
+  insert(2, Name(n1).append("X"));
+
+  startInterest(n1)
+    .setCanBePrefix(true)
+    .setChildSelector(0);
+  CHECK_CS_FIND(1);
+  startInterest(n1)
+    .setCanBePrefix(true)
+    .setChildSelector(1);
+  CHECK_CS_FIND(2);
+  startInterest(n1)
+    .setCanBePrefix(false);
+  CHECK_CS_FIND(1);
+
+  uint8_t digest00[ndn::util::Sha256::DIGEST_SIZE];
+  std::fill_n(digest00, sizeof(digest00), 0x00);
+  Name n3 = Name("/B").append(name::Component::fromImplicitSha256Digest(digest00, sizeof(digest00)));
+  insert(3, Name(n3).append("Y"));
+
+  startInterest(n3)
+    .setCanBePrefix(true)
+    .setChildSelector(0);
+  CHECK_CS_FIND(3);
+  startInterest(n3)
+    .setCanBePrefix(true)
+    .setChildSelector(1);
+  CHECK_CS_FIND(3);
+  startInterest(n3)
+    .setCanBePrefix(false);
+  CHECK_CS_FIND(0);
+}
+
 BOOST_AUTO_TEST_CASE(DigestExclude)
 {
   insert(1, "/A");
@@ -375,6 +426,59 @@ BOOST_AUTO_TEST_CASE(DigestExclude)
   CHECK_CS_FIND(1);
 }
 
+BOOST_AUTO_TEST_CASE(CannotBePrefix)
+{
+  insert(1, "/A/B");
+  Name n2 = insert(2, "/A");
+  Name n3 = insert(3, "/A");
+  insert(4, "/A/C");
+
+  startInterest("/A/B")
+    .setCanBePrefix(false);
+  CHECK_CS_FIND(1);
+
+  startInterest("/A/D")
+    .setCanBePrefix(false);
+  CHECK_CS_FIND(0);
+
+  startInterest("/")
+    .setCanBePrefix(false);
+  CHECK_CS_FIND(0);
+
+  startInterest(n2)
+    .setCanBePrefix(false);
+  CHECK_CS_FIND(2);
+
+  startInterest(n3)
+    .setCanBePrefix(false);
+  CHECK_CS_FIND(3);
+
+  uint32_t expectedLeftmost = n2 < n3 ? 2 : 3;
+  uint32_t expectedRightmost = n2 < n3 ? 3 : 2;
+  startInterest("/A")
+    .setCanBePrefix(false)
+    .setChildSelector(0);
+  CHECK_CS_FIND(expectedLeftmost);
+  startInterest("/A")
+    .setCanBePrefix(false)
+    .setChildSelector(1);
+  CHECK_CS_FIND(expectedRightmost);
+
+  // erasing the leftmost entry of a Name keeps the other entries reachable
+  BOOST_CHECK_EQUAL(erase("/A", 1), 1);
+  startInterest("/A")
+    .setCanBePrefix(false);
+  CHECK_CS_FIND(expectedRightmost);
+
+  BOOST_CHECK_EQUAL(erase("/A", 1), 1);
+  startInterest("/A")
+    .setCanBePrefix(false);
+  CHECK_CS_FIND(0);
+  startInterest("/A/B")
+    .setCanBePrefix(false);
+  CHECK_CS_FIND(1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Find
 
 BOOST_FIXTURE_TEST_CASE(Erase, FindFixture)
@@ -409,6 +513,69 @@ BOOST_FIXTURE_TEST_CASE(Erase, FindFixture)
   BOOST_CHECK_EQUAL(m_cs.size(), 2);
 }
 
+BOOST_FIXTURE_TEST_CASE(EraseFullName, FindFixture)
+{
+  Name n1 = insert(1, "/A");
+  Name n2 = insert(2, "/A");
+  insert(3, "/A/B");
+  BOOST_CHECK_EQUAL(m_cs.size(), 3);
+
+  BOOST_CHECK_EQUAL(erase(n1, 2), 1);
+  BOOST_CHECK_EQUAL(m_cs.size(), 2);
+  startInterest(n1);
+  CHECK_CS_FIND(0);
+  startInterest(n2);
+  CHECK_CS_FIND(2);
+
+  BOOST_CHECK_EQUAL(erase(n1, 2), 0);
+  BOOST_CHECK_EQUAL(m_cs.size(), 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(EraseJob, FindFixture)
+{
+  const size_t nUnderA = Cs::ERASE_JOB_BATCH * 2 + 3;
+  m_cs.setLimit(nUnderA + 1);
+  for (size_t i = 0; i < nUnderA; ++i) {
+    insert(1, Name("/A").appendSequenceNumber(i));
+  }
+  insert(2, "/B");
+
+  optional<size_t> nErased;
+  m_cs.startEraseJob("/A", [&] (size_t nErased1) { nErased = nErased1; });
+  BOOST_CHECK_EQUAL(m_cs.getEraseJobs().size(), 1);
+  BOOST_CHECK_EQUAL(m_cs.size(), nUnderA + 1); // nothing is erased before the event loop runs
+
+  advanceClocks(1_ms, 10);
+  BOOST_REQUIRE(nErased);
+  BOOST_CHECK_EQUAL(*nErased, nUnderA);
+  BOOST_CHECK_EQUAL(m_cs.size(), 1);
+  BOOST_CHECK_EQUAL(m_cs.getEraseJobs().size(), 0);
+
+  // cancel
+  insert(3, "/C/1");
+  insert(4, "/C/2");
+  nErased = nullopt;
+  m_cs.startEraseJob("/C", [&] (size_t nErased1) { nErased = nErased1; });
+  optional<size_t> nCancelled = m_cs.cancelEraseJob("/C");
+  BOOST_REQUIRE(nCancelled);
+  BOOST_CHECK_EQUAL(*nCancelled, 0);
+  BOOST_CHECK(!m_cs.cancelEraseJob("/C"));
+
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK(!nErased);
+  BOOST_CHECK_EQUAL(m_cs.size(), 3);
+}
+
+BOOST_FIXTURE_TEST_CASE(InsertSameName, FindFixture)
+{
+  insert(1, "/A");
+  insert(1, "/A");
+  BOOST_CHECK_EQUAL(m_cs.size(), 1);
+
+  insert(2, "/A");
+  BOOST_CHECK_EQUAL(m_cs.size(), 2);
+}
+
 // When the capacity limit is set to zero, Data cannot be inserted;
 // this test case covers this situation.
 // The behavior of non-zero capacity limit depends on the eviction policy,
@@ -470,6 +637,44 @@ BOOST_FIXTURE_TEST_CASE(CachePolicyNoCache, FindFixture)
   CHECK_CS_FIND(0);
 }
 
+BOOST_FIXTURE_TEST_CASE(MissFilter, FindFixture)
+{
+  auto noCache = [] (Data& data) {
+    data.setTag(make_shared<lp::CachePolicyTag>(
+      lp::CachePolicy().setPolicy(lp::CachePolicyType::NO_CACHE)));
+  };
+
+  insert(1, "/A/B");
+  insert(2, "/A", noCache); // /A/B is cached, so /A is not remembered
+  insert(3, "/C", noCache);
+
+  startInterest("/A").setCanBePrefix(true);
+  CHECK_CS_FIND(1);
+  BOOST_CHECK_EQUAL(m_cs.getNMissFilterHits(), 0);
+
+  startInterest("/C");
+  CHECK_CS_FIND(0);
+  BOOST_CHECK_EQUAL(m_cs.getNMissFilterHits(), 1);
+
+  // admitting Data under a remembered Name clears the filter
+  insert(4, "/C/D");
+  startInterest("/C").setCanBePrefix(true);
+  CHECK_CS_FIND(4);
+  BOOST_CHECK_EQUAL(m_cs.getNMissFilterHits(), 1);
+  BOOST_CHECK_EQUAL(m_cs.getNMissFilterFalsePositives(), 0);
+
+  // Data refused while admission is disabled is remembered
+  m_cs.enableAdmit(false);
+  insert(5, "/E");
+  m_cs.enableAdmit(true);
+  for (uint64_t i = 0; i < Cs::MISS_FILTER_VERIFY_INTERVAL; ++i) {
+    startInterest("/E");
+    CHECK_CS_FIND(0);
+  }
+  BOOST_CHECK_EQUAL(m_cs.getNMissFilterHits(), 1 + Cs::MISS_FILTER_VERIFY_INTERVAL);
+  BOOST_CHECK_EQUAL(m_cs.getNMissFilterFalsePositives(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(Enumeration)
 {
   Cs cs;
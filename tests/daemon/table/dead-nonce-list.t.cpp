@@ -51,6 +51,32 @@ BOOST_AUTO_TEST_CASE(Basic)
   BOOST_CHECK_EQUAL(dnl.has(nameB, nonce1), false);
 }
 
+BOOST_AUTO_TEST_CASE(ManyEntries)
+{
+  Name nameA("ndn:/A");
+  const size_t nEntries = 10000;
+
+  DeadNonceList dnl;
+  size_t memoryUsage0 = dnl.getMemoryUsage();
+  dnl.m_capacity = nEntries * 2;
+  for (uint32_t nonce = 1; nonce <= nEntries; ++nonce) {
+    dnl.add(nameA, nonce);
+  }
+  BOOST_CHECK_EQUAL(dnl.size(), nEntries);
+  BOOST_CHECK_GT(dnl.getMemoryUsage(), memoryUsage0);
+  BOOST_CHECK_GE(dnl.getMemoryUsage(), nEntries * sizeof(uint64_t));
+
+  for (uint32_t nonce = 1; nonce <= nEntries; ++nonce) {
+    BOOST_CHECK_EQUAL(dnl.has(nameA, nonce), true);
+  }
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nEntries + 1), false);
+
+  // duplicate entries are counted separately
+  dnl.add(nameA, 1);
+  BOOST_CHECK_EQUAL(dnl.size(), nEntries + 1);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, 1), true);
+}
+
 BOOST_AUTO_TEST_CASE(MinLifetime)
 {
   BOOST_CHECK_THROW(DeadNonceList dnl(time::milliseconds::zero()), std::invalid_argument);
@@ -236,6 +236,97 @@ BOOST_AUTO_TEST_CASE(Insert_LongestPrefixMatch)
   BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/E").getPrefix(), "/");
 }
 
+BOOST_AUTO_TEST_CASE(PrefixLengthSearch)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  fib.insert("/A/B/C/D");
+  fib.insert("/E");
+  BOOST_CHECK_EQUAL(fib.isPrefixLengthSearchEnabled(), false);
+  fib.enablePrefixLengthSearch(true);
+  BOOST_CHECK_EQUAL(fib.isPrefixLengthSearchEnabled(), true);
+
+  // name tree entries of other tables are not FIB entries
+  Pit pit(nameTree);
+  pit.insert(*makeInterest("/A/B/C/X/Y/Z"));
+
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/D/E/F/G/H/I/J").getPrefix(), "/A/B/C/D");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/X/Y/Z").getPrefix(), "/"); // the empty entry
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A").getPrefix(), "/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/E/F/G").getPrefix(), "/E");
+
+  // new lengths
+  fib.insert("/");
+  fib.insert("/A/B");
+  fib.insert("/E/F");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/X/Y/Z").getPrefix(), "/A/B");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/D/E").getPrefix(), "/A/B/C/D");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A").getPrefix(), "/");
+
+  // /A/B remains a marker for /A/B/C/D
+  fib.erase("/A/B");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/X/Y/Z").getPrefix(), "/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/D/E").getPrefix(), "/A/B/C/D");
+
+  // the only prefix of length 4 is erased
+  fib.erase("/A/B/C/D");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/A/B/C/D/E").getPrefix(), "/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/E/F/G").getPrefix(), "/E/F");
+
+  // Names deeper than the max depth
+  Name longPrefix;
+  for (size_t i = 0; i < Fib::getMaxDepth(); ++i) {
+    longPrefix.append("L");
+  }
+  fib.insert(longPrefix);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(Name(longPrefix).append("M")).getPrefix(),
+                    longPrefix);
+
+  fib.enablePrefixLengthSearch(false);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/E/F/G").getPrefix(), "/E/F");
+}
+
+BOOST_AUTO_TEST_CASE(PrefixLengthSearchEquivalence)
+{
+  NameTree nameTree1;
+  Fib fib1(nameTree1);
+  NameTree nameTree2;
+  Fib fib2(nameTree2);
+  fib2.enablePrefixLengthSearch(true);
+
+  std::mt19937 rng(3425);
+  auto makeName = [&rng] (size_t length) {
+    Name name;
+    for (size_t i = 0; i < length; ++i) {
+      name.append(to_string(std::uniform_int_distribution<int>(0, 3)(rng)));
+    }
+    return name;
+  };
+  std::uniform_int_distribution<size_t> prefixLength(0, 6);
+  std::uniform_int_distribution<size_t> nameLength(0, 12);
+
+  // insertions and erasures cause rebuilds and leave stale markers
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 20; ++i) {
+      Name prefix = makeName(prefixLength(rng));
+      fib1.insert(prefix);
+      fib2.insert(prefix);
+    }
+    for (int i = 0; i < 15; ++i) {
+      Name prefix = makeName(prefixLength(rng));
+      fib1.erase(prefix);
+      fib2.erase(prefix);
+    }
+    BOOST_REQUIRE_EQUAL(fib1.size(), fib2.size());
+
+    for (int i = 0; i < 100; ++i) {
+      Name name = makeName(nameLength(rng));
+      BOOST_CHECK_EQUAL(fib1.findLongestPrefixMatch(name).getPrefix(),
+                        fib2.findLongestPrefixMatch(name).getPrefix());
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(LongestPrefixMatchWithPitEntry)
 {
   NameTree nameTree;
@@ -55,6 +55,39 @@ BOOST_AUTO_TEST_CASE(InProducerRegion)
   BOOST_CHECK_EQUAL(nrt4.isInProducerRegion(fh), true);
 }
 
+BOOST_AUTO_TEST_CASE(InProducerRegionNeighbors)
+{
+  // region names adjacent to /ucla/cs in canonical order
+  NetworkRegionTable nrt;
+  nrt.insert("/ucla");
+  nrt.insert("/ucla/ca");
+  nrt.insert("/ucla/ct");
+  nrt.insert("/ucla/cs-old");
+  nrt.insert("/ucla/cs-old/irl");
+  nrt.insert("/ucla/css");
+  nrt.insert("/verizon");
+
+  DelegationList fh1{{10, "/ucla/cs"}};
+  DelegationList fh2{{10, "/telia"}, {20, "/ucla/cs-old"}};
+  DelegationList fh3{{10, "/"}};
+  DelegationList fh4{{10, "/verizon/nj"}};
+  DelegationList fh5{{10, "/ucla/cs/irl"}};
+  DelegationList fh6{{10, "/ucla/cs/software"}};
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(fh1), false);
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(fh2), true);
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(fh3), true);
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(fh4), false);
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(DelegationList()), false);
+
+  nrt.insert("/ucla/cs/irl/lab");
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(fh1), true);
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(fh5), true);
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(fh6), false);
+
+  NetworkRegionTable empty;
+  BOOST_CHECK_EQUAL(empty.isInProducerRegion(fh3), false);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -216,6 +216,32 @@ BOOST_AUTO_TEST_CASE(OutRecordNack)
   BOOST_CHECK(outR.getIncomingNack() == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(MayHaveNonce)
+{
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  shared_ptr<Interest> interest = makeInterest("/A", 0x083); // fingerprint bits 3 and 2
+  Entry entry(*interest);
+  BOOST_CHECK_EQUAL(entry.mayHaveNonce(0x083), false);
+
+  entry.insertOrUpdateInRecord(*face1, *interest);
+  BOOST_CHECK_EQUAL(entry.mayHaveNonce(0x083), true);
+  BOOST_CHECK_EQUAL(entry.mayHaveNonce(0x142), false); // bits 2 and 5
+
+  shared_ptr<Interest> interest2 = makeInterest("/A", 0x142);
+  entry.insertOrUpdateOutRecord(*face2, *interest2);
+  BOOST_CHECK_EQUAL(entry.mayHaveNonce(0x142), true);
+  BOOST_CHECK_EQUAL(entry.mayHaveNonce(0x207), false); // bits 7 and 8
+
+  // false positive: bits 5 and 3 are both set by other nonces
+  BOOST_CHECK_EQUAL(entry.mayHaveNonce(0x0C5), true);
+
+  // fingerprints are kept after records are deleted
+  entry.clearInRecords();
+  entry.deleteOutRecord(*face2);
+  BOOST_CHECK_EQUAL(entry.mayHaveNonce(0x083), true);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestPitEntry
 BOOST_AUTO_TEST_SUITE_END() // Table
 
@@ -245,6 +245,32 @@ BOOST_AUTO_TEST_CASE(FindEffectiveStrategyWithPitEntry)
   BOOST_CHECK_EQUAL(this->findInstanceName(*pitFull), strategyNameQ);
 }
 
+BOOST_AUTO_TEST_CASE(FindEffectiveStrategyCacheInvalidation)
+{
+  BOOST_CHECK(sc.insert("/A", strategyNameP));
+
+  Pit& pit = forwarder.getPit();
+  shared_ptr<Interest> interestABC = makeInterest("/A/B/C");
+  shared_ptr<pit::Entry> pitABC = pit.insert(*interestABC).first;
+  Measurements& measurements = forwarder.getMeasurements();
+  measurements::Entry& mAB = measurements.get("/A/B");
+
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), strategyNameP);
+
+  BOOST_CHECK(sc.insert("/A/B", strategyNameQ));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameQ);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), strategyNameQ);
+
+  sc.erase("/A/B");
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), strategyNameP);
+
+  BOOST_CHECK(sc.insert("/A", strategyNameQ));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameQ);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), strategyNameQ);
+}
+
 BOOST_AUTO_TEST_CASE(FindEffectiveStrategyWithMeasurementsEntry)
 {
   BOOST_CHECK(sc.insert("/A", strategyNameP));
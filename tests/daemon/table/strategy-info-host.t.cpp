@@ -77,6 +77,25 @@ public:
   int m_id;
 };
 
+template<int TYPE_ID>
+class DummyStrategyInfoN : public StrategyInfo, noncopyable
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return TYPE_ID;
+  }
+
+  DummyStrategyInfoN(int id)
+    : m_id(id)
+  {
+  }
+
+public:
+  int m_id;
+};
+
 BOOST_AUTO_TEST_SUITE(Table)
 BOOST_FIXTURE_TEST_SUITE(TestStrategyInfoHost, BaseFixture)
 
@@ -131,6 +150,39 @@ BOOST_AUTO_TEST_CASE(Types)
   BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfo>(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(ManyTypes)
+{
+  StrategyInfoHost host;
+
+  host.insertStrategyInfo<DummyStrategyInfoN<11>>(11);
+  host.insertStrategyInfo<DummyStrategyInfoN<12>>(12);
+  host.insertStrategyInfo<DummyStrategyInfoN<13>>(13);
+  DummyStrategyInfoN<14>* info14 = host.insertStrategyInfo<DummyStrategyInfoN<14>>(14).first;
+
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfoN<11>>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfoN<11>>()->m_id, 11);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfoN<13>>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfoN<13>>()->m_id, 13);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfoN<14>>(), info14);
+
+  BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfoN<13>>(), 1);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<13>>() == nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfoN<14>>(), info14);
+
+  BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfoN<11>>(), 1);
+  BOOST_CHECK_EQUAL(host.insertStrategyInfo<DummyStrategyInfoN<15>>(15).second, true);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfoN<15>>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfoN<15>>()->m_id, 15);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfoN<12>>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfoN<12>>()->m_id, 12);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfoN<14>>(), info14);
+
+  host.clearStrategyInfo();
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<12>>() == nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<14>>() == nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfoN<15>>() == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestStrategyInfoHost
 BOOST_AUTO_TEST_SUITE_END() // Table
 
@@ -28,7 +28,9 @@
 
 #include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
 
+#include <cmath>
 #include <iostream>
+#include <random>
 
 #ifdef HAVE_VALGRIND
 #include <valgrind/callgrind.h>
@@ -244,5 +246,83 @@ BOOST_FIXTURE_TEST_CASE(Rightmost, CsBenchmarkFixture)
   std::cout << "find(rightmost) " << (N_INTERESTS * N_CHILDREN * REPEAT) << ": " << d << std::endl;
 }
 
+// hit ratio and throughput of replacement policies on a Zipf workload with scan pollution
+BOOST_FIXTURE_TEST_CASE(ZipfWithScans, CsBenchmarkFixture)
+{
+  constexpr size_t CAPACITY = 10000;
+  constexpr size_t N_CATALOG = CAPACITY * 5;
+  constexpr double ZIPF_ALPHA = 0.9;
+  constexpr size_t N_REQUESTS = 500000;
+  constexpr size_t SCAN_INTERVAL = 50000; // a scan starts after every SCAN_INTERVAL Zipf requests
+  constexpr size_t SCAN_LENGTH = CAPACITY;
+  constexpr size_t N_SCANS = N_REQUESTS / SCAN_INTERVAL;
+
+  auto makeWorkload = [] (const Name& prefix, size_t count) {
+    std::vector<std::pair<shared_ptr<Interest>, shared_ptr<Data>>> workload(count);
+    for (size_t i = 0; i < count; ++i) {
+      Name name = Name(prefix).appendNumber(i);
+      workload[i].first = make_shared<Interest>(name);
+      workload[i].first->setCanBePrefix(false);
+      workload[i].second = makeData(name);
+    }
+    return workload;
+  };
+  auto catalog = makeWorkload("/cs/benchmark/zipf", N_CATALOG);
+  auto scans = makeWorkload("/cs/benchmark/scan", N_SCANS * SCAN_LENGTH);
+
+  // Zipf ranks are drawn by inverting the cumulative distribution
+  std::vector<double> cdf(N_CATALOG);
+  double sum = 0.0;
+  for (size_t i = 0; i < N_CATALOG; ++i) {
+    sum += 1.0 / std::pow(static_cast<double>(i + 1), ZIPF_ALPHA);
+    cdf[i] = sum;
+  }
+  std::mt19937 rng(2681);
+  std::uniform_real_distribution<double> uniform(0.0, sum);
+  std::vector<size_t> sequence;
+  sequence.reserve(N_REQUESTS + N_SCANS * SCAN_LENGTH);
+  size_t nextScanItem = 0;
+  for (size_t i = 0; i < N_REQUESTS; ++i) {
+    size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+    sequence.push_back(std::min(rank, N_CATALOG - 1));
+    if ((i + 1) % SCAN_INTERVAL == 0) {
+      for (size_t j = 0; j < SCAN_LENGTH; ++j) {
+        sequence.push_back(N_CATALOG + nextScanItem++); // index into scans, offset by N_CATALOG
+      }
+    }
+  }
+
+  for (const char* policyName : {"lru", "priority_fifo", "tinylfu", "clock"}) {
+    Cs policyCs;
+    policyCs.setPolicy(cs::Policy::create(policyName));
+    policyCs.setLimit(CAPACITY);
+
+    size_t nHits = 0, nZipfRequests = 0, nZipfHits = 0;
+    time::microseconds d = timedRun([&] {
+      for (size_t index : sequence) {
+        bool isZipf = index < N_CATALOG;
+        const auto& item = isZipf ? catalog[index] : scans[index - N_CATALOG];
+        bool isHit = false;
+        policyCs.find(*item.first,
+                      [&isHit] (const Interest&, const Data&) { isHit = true; },
+                      [] (const Interest&) {});
+        if (isHit) {
+          ++nHits;
+        }
+        else {
+          policyCs.insert(*item.second, false);
+        }
+        nZipfRequests += static_cast<size_t>(isZipf);
+        nZipfHits += static_cast<size_t>(isZipf && isHit);
+      }
+    });
+
+    std::cout << "zipf-with-scans " << policyName << " " << sequence.size() << ": " << d
+              << ", " << (sequence.size() * 1000000.0 / std::max<int64_t>(d.count(), 1)) << " ops/s"
+              << ", hit-ratio " << (100.0 * nHits / sequence.size()) << "%"
+              << ", zipf-hit-ratio " << (100.0 * nZipfHits / nZipfRequests) << "%" << std::endl;
+  }
+}
+
 } // namespace tests
 } // namespace nfd
@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "fw/forwarder.hpp"
+#include "face/null-face.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+#include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
+
+#include <iostream>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace tests {
+
+class ForwarderBenchmarkFixture
+{
+protected:
+  ForwarderBenchmarkFixture()
+    : m_downstream(face::makeNullFace())
+    , m_upstream(face::makeNullFace())
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    m_forwarder.addFace(m_downstream);
+    m_forwarder.addFace(m_upstream);
+    m_forwarder.getFib().insert("/bench").first->addOrUpdateNextHop(*m_upstream, 0, 0);
+    m_forwarder.getCs().setLimit(CS_CAPACITY);
+  }
+
+  static time::microseconds
+  timedRun(const std::function<void()>& f)
+  {
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = time::steady_clock::now();
+    f();
+    auto t2 = time::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  /** \brief makes a Data packet as decoded by GenericLinkService, with HopCountTag
+   */
+  static shared_ptr<Data>
+  makeData(const Name& name)
+  {
+    auto data = make_shared<Data>(name);
+    data->setContent(std::vector<uint8_t>(100, 0xBB).data(), 100);
+    ndn::SignatureSha256WithRsa fakeSignature;
+    fakeSignature.setValue(ndn::encoding::makeEmptyBlock(tlv::SignatureValue));
+    data->setSignature(fakeSignature);
+    data->wireEncode();
+    data->setTag(make_shared<lp::HopCountTag>(1));
+    return data;
+  }
+
+  void
+  makeWorkload(size_t count)
+  {
+    for (size_t i = 0; i < count; ++i) {
+      Name name("/bench");
+      name.appendNumber(i % 16);
+      name.appendNumber(i);
+      m_interests.push_back(make_shared<Interest>(name));
+      m_data.push_back(makeData(name));
+    }
+  }
+
+protected:
+  Forwarder m_forwarder;
+  shared_ptr<Face> m_downstream;
+  shared_ptr<Face> m_upstream;
+  std::vector<shared_ptr<Interest>> m_interests;
+  std::vector<shared_ptr<Data>> m_data;
+
+  static constexpr size_t CS_CAPACITY = 50000;
+  static constexpr size_t N_WORKLOAD = CS_CAPACITY * 4;
+};
+
+// Interest-Data exchanges through the forwarding pipelines;
+// each Interest misses the CS, and each Data satisfies one PIT entry and is inserted into the CS.
+// No simulation is running, so expiry timers do not fire and satisfied PIT entries are kept.
+BOOST_FIXTURE_TEST_CASE(InterestData, ForwarderBenchmarkFixture)
+{
+  makeWorkload(N_WORKLOAD);
+
+  time::microseconds d = timedRun([&] {
+    for (size_t i = 0; i < N_WORKLOAD; ++i) {
+      m_forwarder.startProcessInterest(*m_downstream, *m_interests[i]);
+      m_forwarder.startProcessData(*m_upstream, *m_data[i]);
+    }
+  });
+
+  std::cout << "interest-data " << N_WORKLOAD << ": " << d
+            << ", " << (N_WORKLOAD * 1000000.0 / std::max<int64_t>(d.count(), 1)) << " exchanges/s"
+            << std::endl;
+}
+
+// the copy that the incoming Data pipeline used to make of each Data before CS insertion,
+// in order to strip HopCountTag; subtract this from InterestData to estimate the former cost
+BOOST_FIXTURE_TEST_CASE(DataCopyWithoutTag, ForwarderBenchmarkFixture)
+{
+  makeWorkload(N_WORKLOAD);
+
+  time::microseconds d = timedRun([&] {
+    for (size_t i = 0; i < N_WORKLOAD; ++i) {
+      auto dataCopyWithoutTag = make_shared<Data>(*m_data[i]);
+      dataCopyWithoutTag->removeTag<lp::HopCountTag>();
+    }
+  });
+
+  std::cout << "data-copy-without-tag " << N_WORKLOAD << ": " << d << std::endl;
+}
+
+} // namespace tests
+} // namespace nfd
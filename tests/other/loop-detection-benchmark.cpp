@@ -0,0 +1,195 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "fw/algorithm.hpp"
+#include "fw/best-route-strategy2.hpp"
+#include "fw/multicast-strategy.hpp"
+#include "face/null-face.hpp"
+#include "tests/daemon/fw/topology-tester.hpp"
+
+#include <chrono>
+#include <iostream>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace tests {
+
+using fw::tests::TopologyTester;
+using fw::tests::TopologyNode;
+
+class LoopDetectionBenchmarkFixture : public UnitTestTimeFixture
+{
+protected:
+  LoopDetectionBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+  }
+
+  /** \brief previous implementation: compare the nonce with every in-record and out-record
+   */
+  static int
+  findDuplicateNonceByWalk(const pit::Entry& pitEntry, uint32_t nonce, const Face& face)
+  {
+    int dnw = fw::DUPLICATE_NONCE_NONE;
+    for (const pit::InRecord& inRecord : pitEntry.getInRecords()) {
+      if (inRecord.getLastNonce() == nonce) {
+        dnw |= &inRecord.getFace() == &face ? fw::DUPLICATE_NONCE_IN_SAME :
+                                              fw::DUPLICATE_NONCE_IN_OTHER;
+      }
+    }
+    for (const pit::OutRecord& outRecord : pitEntry.getOutRecords()) {
+      if (outRecord.getLastNonce() == nonce) {
+        dnw |= &outRecord.getFace() == &face ? fw::DUPLICATE_NONCE_OUT_SAME :
+                                               fw::DUPLICATE_NONCE_OUT_OTHER;
+      }
+    }
+    return dnw;
+  }
+
+  template<typename F>
+  static void
+  runLookups(const std::string& label, size_t nRecords, const pit::Entry& pitEntry,
+             const std::vector<uint32_t>& nonces, const Face& face, const F& findDuplicateNonce)
+  {
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    size_t nDuplicates = 0;
+    auto t1 = std::chrono::steady_clock::now();
+    for (uint32_t nonce : nonces) {
+      nDuplicates += static_cast<size_t>(findDuplicateNonce(pitEntry, nonce, face) != 0);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    auto d = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    std::cout << label << " records=" << nRecords << " lookups=" << nonces.size()
+              << ": " << d << " microseconds"
+              << ", " << (nonces.size() * 1000000.0 / std::max<int64_t>(d, 1)) << " lookups/s"
+              << ", duplicates=" << nDuplicates << std::endl;
+  }
+};
+
+// A PIT entry of a multipath strategy has one in-record and one out-record per face.
+// One in ten looked up nonces is a duplicate; the others are new, as with retransmissions
+// and with Interests aggregated from other downstreams.
+BOOST_FIXTURE_TEST_CASE(FindDuplicateNonce, LoopDetectionBenchmarkFixture)
+{
+  const size_t nLookups = 2000000;
+
+  for (size_t nFaces : {2, 8, 32}) {
+    std::vector<shared_ptr<Face>> faces;
+    auto interest = makeInterest("/benchmark/loop-detection");
+    pit::Entry pitEntry(*interest);
+    std::vector<uint32_t> recordNonces;
+    for (size_t i = 0; i < nFaces; ++i) {
+      faces.push_back(face::makeNullFace());
+      interest->refreshNonce();
+      pitEntry.insertOrUpdateInRecord(*faces.back(), *interest);
+      recordNonces.push_back(interest->getNonce());
+      interest->refreshNonce();
+      pitEntry.insertOrUpdateOutRecord(*faces.back(), *interest);
+      recordNonces.push_back(interest->getNonce());
+    }
+
+    std::vector<uint32_t> nonces;
+    nonces.reserve(nLookups);
+    for (size_t i = 0; i < nLookups; ++i) {
+      if (i % 10 == 0) {
+        nonces.push_back(recordNonces[i / 10 % recordNonces.size()]);
+      }
+      else {
+        interest->refreshNonce();
+        nonces.push_back(interest->getNonce());
+      }
+    }
+
+    runLookups("walk", nFaces * 2, pitEntry, nonces, *faces.front(), &findDuplicateNonceByWalk);
+    runLookups("fingerprint", nFaces * 2, pitEntry, nonces, *faces.front(), &fw::findDuplicateNonce);
+  }
+}
+
+// The consumer router multicasts every Interest over nPaths parallel paths toward the producer
+// router, which receives each nonce once per path and detects all but the first as duplicates.
+//
+//             +-- R0 --+
+//  consumer - C-- R1 --P - producer
+//             +-- .. --+
+BOOST_FIXTURE_TEST_CASE(MultipathTopology, LoopDetectionBenchmarkFixture)
+{
+  const size_t nInterests = 2000;
+
+  for (size_t nPaths : {2, 8, 16}) {
+    TopologyTester topo;
+    TopologyNode nodeC = topo.addForwarder("C");
+    TopologyNode nodeP = topo.addForwarder("P");
+    topo.setStrategy<fw::MulticastStrategy>(nodeC);
+
+    for (size_t i = 0; i < nPaths; ++i) {
+      TopologyNode nodeR = topo.addForwarder("R" + to_string(i));
+      topo.setStrategy<fw::BestRouteStrategy2>(nodeR);
+      auto linkCR = topo.addLink("CR" + to_string(i), 1_ms, {nodeC, nodeR});
+      auto linkRP = topo.addLink("RP" + to_string(i), 1_ms, {nodeR, nodeP});
+      topo.registerPrefix(nodeC, linkCR->getFace(nodeC), "/P");
+      topo.registerPrefix(nodeR, linkRP->getFace(nodeR), "/P");
+    }
+
+    auto consumer = topo.addAppFace("consumer", nodeC);
+    auto producer = topo.addAppFace("producer", nodeP, "/P");
+    topo.addEchoProducer(producer->getClientFace(), "/P");
+    topo.addIntervalConsumer(consumer->getClientFace(), "/P", 1_ms, nInterests);
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = std::chrono::steady_clock::now();
+    this->advanceClocks(1_ms, time::milliseconds(nInterests + 100));
+    auto t2 = std::chrono::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    const auto& counters = topo.getForwarder(nodeP).getCounters();
+    auto d = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    std::cout << "paths=" << nPaths << " interests=" << nInterests << ": " << d << " microseconds"
+              << ", producer router received " << counters.nInInterests << " Interests"
+              << " and sent " << counters.nOutNacks << " Nacks" << std::endl;
+  }
+}
+
+} // namespace tests
+} // namespace nfd
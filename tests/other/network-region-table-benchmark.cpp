@@ -0,0 +1,139 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "table/network-region-table.hpp"
+
+#include <iostream>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace tests {
+
+class NetworkRegionTableBenchmarkFixture
+{
+protected:
+  NetworkRegionTableBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+  }
+
+  /** \brief populate the table with nRegions region names under nProviders providers,
+   *         and make forwarding hints of nDelegations delegations each
+   *
+   *  One in hitInterval forwarding hints has its last delegation inside a configured region;
+   *  the other forwarding hints only have delegations that are outside every region.
+   */
+  void
+  populate(size_t nRegions, size_t nProviders, size_t nDelegations, size_t nHints, size_t hitInterval)
+  {
+    for (size_t i = 0; i < nRegions; ++i) {
+      nrt.insert(Name("/provider").appendNumber(i % nProviders)
+                 .append("region").appendNumber(i).append("access"));
+    }
+
+    for (size_t i = 0; i < nHints; ++i) {
+      DelegationList fh;
+      for (size_t j = 0; j < nDelegations; ++j) {
+        Name name("/provider");
+        name.appendNumber((i + j) % nProviders).append("region").appendNumber(nRegions + i % 1000);
+        if (j == nDelegations - 1 && i % hitInterval == 0) {
+          size_t region = i % nRegions;
+          name = Name("/provider").appendNumber(region % nProviders)
+                 .append("region").appendNumber(region);
+        }
+        fh.insert(j + 1, name);
+      }
+      hints.push_back(std::move(fh));
+    }
+  }
+
+  /** \brief previous implementation: compare every region name with every delegation
+   */
+  static bool
+  isInProducerRegionLinear(const NetworkRegionTable& nrt, const DelegationList& forwardingHint)
+  {
+    for (const Name& regionName : nrt) {
+      for (const Delegation& delegation : forwardingHint) {
+        if (delegation.name.isPrefixOf(regionName)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  template<typename F>
+  void
+  run(const std::string& label, const F& isInProducerRegion)
+  {
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    size_t nHits = 0;
+    auto t1 = time::steady_clock::now();
+    for (const DelegationList& fh : hints) {
+      nHits += static_cast<size_t>(isInProducerRegion(fh));
+    }
+    auto t2 = time::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    auto d = time::duration_cast<time::microseconds>(t2 - t1);
+    size_t nLookups = hints.size();
+    std::cout << label << " regions=" << nrt.size() << " lookups=" << nLookups << ": " << d
+              << ", " << (nLookups * 1000000.0 / std::max<int64_t>(d.count(), 1)) << " lookups/s"
+              << ", hits=" << nHits << std::endl;
+  }
+
+protected:
+  NetworkRegionTable nrt;
+  std::vector<DelegationList> hints;
+};
+
+// This test case models a mobile deployment with hundreds of producer regions,
+// where transit Interests carry 2-3 delegations that are not in any region.
+BOOST_FIXTURE_TEST_CASE(IsInProducerRegion, NetworkRegionTableBenchmarkFixture)
+{
+  for (size_t nRegions : {10, 100, 500, 2000}) {
+    nrt.clear();
+    hints.clear();
+    populate(nRegions, 20, 3, 100000, 50);
+
+    run("linear", [this] (const DelegationList& fh) { return isInProducerRegionLinear(nrt, fh); });
+    run("sorted", [this] (const DelegationList& fh) { return nrt.isInProducerRegion(fh); });
+  }
+}
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,209 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "core/spsc-ring.hpp"
+#include "fw/shard-selector.hpp"
+#include "table/cs.hpp"
+#include "table/pit.hpp"
+
+#include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
+
+#include <iostream>
+#include <thread>
+
+namespace nfd {
+namespace tests {
+
+/** \brief a partition of PIT and CS owned by a worker thread
+ */
+class Shard : noncopyable
+{
+public:
+  Shard(size_t csCapacity, const std::vector<shared_ptr<Interest>>& interests,
+        const std::vector<shared_ptr<Data>>& data)
+    : ring(RING_CAPACITY)
+    , m_pit(m_nameTree)
+    , m_cs(csCapacity)
+    , m_interests(interests)
+    , m_data(data)
+  {
+  }
+
+  /** \brief processes packets from the ring until STOP is received
+   */
+  void
+  run()
+  {
+    size_t packet = 0;
+    while (true) {
+      if (!ring.pop(packet)) {
+        std::this_thread::yield();
+        continue;
+      }
+      if (packet == STOP) {
+        return;
+      }
+
+      size_t index = packet >> 1;
+      if ((packet & 1) == 0) {
+        this->processInterest(*m_interests[index]);
+      }
+      else {
+        this->processData(*m_data[index]);
+      }
+    }
+  }
+
+private:
+  void
+  processInterest(const Interest& interest)
+  {
+    m_cs.find(interest,
+              [] (const Interest&, const Data&) {},
+              [this] (const Interest& interest) { m_pit.insert(interest); });
+  }
+
+  void
+  processData(const Data& data)
+  {
+    for (const shared_ptr<pit::Entry>& pitEntry : m_pit.findAllDataMatches(data)) {
+      m_pit.erase(pitEntry.get());
+    }
+    m_cs.insert(data);
+  }
+
+public:
+  static constexpr size_t STOP = std::numeric_limits<size_t>::max();
+  static constexpr size_t RING_CAPACITY = 4096;
+
+  SpscRing<size_t> ring;
+
+private:
+  NameTree m_nameTree;
+  Pit m_pit;
+  Cs m_cs;
+  const std::vector<shared_ptr<Interest>>& m_interests;
+  const std::vector<shared_ptr<Data>>& m_data;
+};
+
+class ShardBenchmarkFixture
+{
+protected:
+  ShardBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    for (size_t i = 0; i < N_EXCHANGES; ++i) {
+      Name name("/shard");
+      name.appendNumber(i % N_PREFIXES);
+      name.appendNumber(i);
+      interests.push_back(make_shared<Interest>(name));
+
+      auto data = make_shared<Data>(name);
+      ndn::SignatureSha256WithRsa fakeSignature;
+      fakeSignature.setValue(ndn::encoding::makeEmptyBlock(tlv::SignatureValue));
+      data->setSignature(fakeSignature);
+      data->wireEncode();
+      this->data.push_back(data);
+    }
+  }
+
+  /** \brief dispatches Interest-Data exchanges to \p nShards worker threads
+   *  \return duration until all workers have processed all packets
+   */
+  time::microseconds
+  runExchanges(size_t nShards)
+  {
+    fw::ShardSelector select(nShards, SHARD_PREFIX_LENGTH);
+    std::vector<unique_ptr<Shard>> shards;
+    for (size_t i = 0; i < nShards; ++i) {
+      shards.push_back(make_unique<Shard>(CS_CAPACITY / nShards, interests, data));
+    }
+
+    auto dispatch = [&] (size_t shard, size_t packet) {
+      while (!shards[shard]->ring.push(std::move(packet))) {
+        std::this_thread::yield();
+      }
+    };
+
+    auto t1 = time::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (auto& shard : shards) {
+      workers.emplace_back(&Shard::run, shard.get());
+    }
+
+    // each Data arrives DATA_GAP packets after its Interest
+    for (size_t i = 0; i < N_EXCHANGES + DATA_GAP; ++i) {
+      if (i < N_EXCHANGES) {
+        dispatch(select(interests[i]->getName()), i << 1);
+      }
+      if (i >= DATA_GAP) {
+        size_t j = i - DATA_GAP;
+        dispatch(select(data[j]->getName()), (j << 1) | 1);
+      }
+    }
+    for (size_t i = 0; i < nShards; ++i) {
+      dispatch(i, Shard::STOP);
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+
+    auto t2 = time::steady_clock::now();
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+protected:
+  static constexpr size_t N_EXCHANGES = 1000000;
+  static constexpr size_t N_PREFIXES = 1024;
+  static constexpr size_t DATA_GAP = 20000;
+  static constexpr size_t CS_CAPACITY = 65536;
+  static constexpr size_t SHARD_PREFIX_LENGTH = 2;
+
+  std::vector<shared_ptr<Interest>> interests;
+  std::vector<shared_ptr<Data>> data;
+};
+
+// Interest-Data exchanges processed by PIT and CS partitions on 1, 2, 4, and 8 worker threads.
+// A dispatcher thread assigns each packet to a shard by Name, and passes it through an SpscRing.
+// Throughput scales only up to the number of available cores, minus one for the dispatcher.
+BOOST_FIXTURE_TEST_CASE(Scaling, ShardBenchmarkFixture)
+{
+  std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+
+  for (size_t nShards : {1, 2, 4, 8}) {
+    time::microseconds d = runExchanges(nShards);
+    std::cout << "shards=" << nShards << " exchanges=" << N_EXCHANGES << ": " << d
+              << ", " << (N_EXCHANGES * 1000000.0 / std::max<int64_t>(d.count(), 1)) << " exchanges/s"
+              << std::endl;
+  }
+}
+
+} // namespace tests
+} // namespace nfd
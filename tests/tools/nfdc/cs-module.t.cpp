@@ -170,6 +170,122 @@ BOOST_AUTO_TEST_CASE(ErrorCommand)
 
 BOOST_AUTO_TEST_SUITE_END() // EraseCommand
 
+BOOST_FIXTURE_TEST_SUITE(EraseStartCommand, ExecuteCommandFixture)
+
+BOOST_AUTO_TEST_CASE(Normal)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    ControlParameters req = MOCK_NFD_MGMT_REQUIRE_COMMAND_IS("/localhost/nfd/cs/erase-start");
+    BOOST_REQUIRE(req.hasName());
+    BOOST_CHECK_EQUAL(req.getName(), "/QmVv2bXq");
+
+    ControlParameters resp;
+    resp.setName("/QmVv2bXq");
+    resp.setCount(0);
+    this->succeedCommand(interest, resp);
+  };
+
+  this->execute("cs erase-start /QmVv2bXq");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal("cs-erase-started prefix=/QmVv2bXq erased=0\n"));
+  BOOST_CHECK(err.is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(ErrorCommand)
+{
+  this->processInterest = nullptr; // no response to command
+
+  this->execute("cs erase-start /QmVv2bXq");
+  BOOST_CHECK_EQUAL(exitCode, 1);
+  BOOST_CHECK(out.is_empty());
+  BOOST_CHECK(err.is_equal("Error 10060 when starting CS erase job: request timed out\n"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // EraseStartCommand
+
+BOOST_FIXTURE_TEST_SUITE(EraseCancelCommand, ExecuteCommandFixture)
+
+BOOST_AUTO_TEST_CASE(Normal)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    ControlParameters req = MOCK_NFD_MGMT_REQUIRE_COMMAND_IS("/localhost/nfd/cs/erase-cancel");
+    BOOST_REQUIRE(req.hasName());
+    BOOST_CHECK_EQUAL(req.getName(), "/n4sMfx1b");
+
+    ControlParameters resp;
+    resp.setName("/n4sMfx1b");
+    resp.setCount(3072);
+    this->succeedCommand(interest, resp);
+  };
+
+  this->execute("cs erase-cancel /n4sMfx1b");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal("cs-erase-canceled prefix=/n4sMfx1b erased=3072\n"));
+  BOOST_CHECK(err.is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(NoJob)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    MOCK_NFD_MGMT_REQUIRE_COMMAND_IS("/localhost/nfd/cs/erase-cancel");
+    this->failCommand(interest, 404, "No erase job for this prefix");
+  };
+
+  this->execute("cs erase-cancel /n4sMfx1b");
+  BOOST_CHECK_EQUAL(exitCode, 1);
+  BOOST_CHECK(out.is_empty());
+  BOOST_CHECK(err.is_equal("Error 404 when canceling CS erase job: No erase job for this prefix\n"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // EraseCancelCommand
+
+BOOST_FIXTURE_TEST_SUITE(EraseJobsCommand, ExecuteCommandFixture)
+
+BOOST_AUTO_TEST_CASE(Normal)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    BOOST_REQUIRE(Name("/localhost/nfd/cs/erase-jobs").isPrefixOf(interest.getName()));
+
+    CsEraseJob job1, job2;
+    job1.setName("/4dGpVuJm")
+        .setNErased(1024);
+    job2.setName("/m3qZ9Lc")
+        .setNErased(64);
+    this->sendDataset(interest.getName(), job1, job2);
+  };
+
+  this->execute("cs erase-jobs");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal("prefix=/4dGpVuJm erased=1024\n"
+                           "prefix=/m3qZ9Lc erased=64\n"));
+  BOOST_CHECK(err.is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    BOOST_REQUIRE(Name("/localhost/nfd/cs/erase-jobs").isPrefixOf(interest.getName()));
+    this->sendEmptyDataset(interest.getName());
+  };
+
+  this->execute("cs erase-jobs");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_empty());
+  BOOST_CHECK(err.is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(ErrorDataset)
+{
+  this->processInterest = nullptr; // no response to dataset
+
+  this->execute("cs erase-jobs");
+  BOOST_CHECK_EQUAL(exitCode, 1);
+  BOOST_CHECK(out.is_empty());
+  BOOST_CHECK(err.is_equal("Error 10060 when fetching CS erase jobs dataset: Timeout exceeded\n"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // EraseJobsCommand
+
 const std::string STATUS_XML = stripXmlSpaces(R"XML(
   <cs>
     <capacity>31807</capacity>
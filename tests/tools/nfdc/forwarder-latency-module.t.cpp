@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "nfdc/forwarder-latency-module.hpp"
+#include "core/latency-tlv.hpp"
+
+#include "status-fixture.hpp"
+
+namespace nfd {
+namespace tools {
+namespace nfdc {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Nfdc)
+BOOST_FIXTURE_TEST_SUITE(TestForwarderLatencyModule, StatusFixture<ForwarderLatencyModule>)
+
+/** \brief a PipelineStageLatency block that can be passed to sendDataset
+ */
+class StageLatencyPayload
+{
+public:
+  StageLatencyPayload(const std::string& stageName, uint64_t nSamples, uint64_t totalNanoseconds,
+                      const std::vector<uint64_t>& buckets)
+    : m_block(latency_tlv::PipelineStageLatency)
+  {
+    using namespace ndn::encoding;
+    m_block.push_back(makeStringBlock(latency_tlv::StageName, stageName));
+    m_block.push_back(makeNonNegativeIntegerBlock(latency_tlv::NSamples, nSamples));
+    m_block.push_back(makeNonNegativeIntegerBlock(latency_tlv::TotalNanoseconds,
+                                                  totalNanoseconds));
+    for (uint64_t count : buckets) {
+      m_block.push_back(makeNonNegativeIntegerBlock(latency_tlv::BucketCount, count));
+    }
+    m_block.encode();
+  }
+
+  const Block&
+  wireEncode() const
+  {
+    return m_block;
+  }
+
+  template<ndn::encoding::Tag TAG>
+  size_t
+  wireEncode(ndn::encoding::EncodingImpl<TAG>& encoder) const
+  {
+    return encoder.prependBlock(m_block);
+  }
+
+private:
+  Block m_block;
+};
+
+const std::string STATUS_XML = stripXmlSpaces(R"XML(
+  <pipelineLatency>
+    <stage>
+      <name>incoming-interest</name>
+      <nSamples>3</nSamples>
+      <meanNanoseconds>2000</meanNanoseconds>
+      <p50Nanoseconds>2048</p50Nanoseconds>
+      <p99Nanoseconds>4096</p99Nanoseconds>
+    </stage>
+    <stage>
+      <name>pit-match</name>
+      <nSamples>0</nSamples>
+      <meanNanoseconds>0</meanNanoseconds>
+      <p50Nanoseconds>0</p50Nanoseconds>
+      <p99Nanoseconds>0</p99Nanoseconds>
+    </stage>
+  </pipelineLatency>
+)XML");
+
+const std::string STATUS_TEXT = std::string(R"TEXT(
+Pipeline stage latency:
+  incoming-interest samples=3 mean=2000ns p50=2048ns p99=4096ns
+  pit-match samples=0 mean=0ns p50=0ns p99=0ns
+)TEXT").substr(1);
+
+BOOST_AUTO_TEST_CASE(Status)
+{
+  this->fetchStatus();
+  StageLatencyPayload payload1("incoming-interest", 3, 6000, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1});
+  StageLatencyPayload payload2("pit-match", 0, 0, {});
+  this->sendDataset("/localhost/nfd/status/latency", payload1, payload2);
+  this->prepareStatusOutput();
+
+  BOOST_CHECK(statusXml.is_equal(STATUS_XML));
+  BOOST_CHECK(statusText.is_equal(STATUS_TEXT));
+}
+
+BOOST_AUTO_TEST_CASE(Quantile)
+{
+  PipelineStageLatency item;
+  BOOST_CHECK_EQUAL(item.getQuantile(0.5), 0);
+
+  item.nSamples = 100;
+  item.buckets = {0, 0, 0, 90, 9, 1};
+  BOOST_CHECK_EQUAL(item.getQuantile(0.0), 16);
+  BOOST_CHECK_EQUAL(item.getQuantile(0.5), 16);
+  BOOST_CHECK_EQUAL(item.getQuantile(0.9), 16);
+  BOOST_CHECK_EQUAL(item.getQuantile(0.95), 32);
+  BOOST_CHECK_EQUAL(item.getQuantile(1.0), 64);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestForwarderLatencyModule
+BOOST_AUTO_TEST_SUITE_END() // Nfdc
+
+} // namespace tests
+} // namespace nfdc
+} // namespace tools
+} // namespace nfd
@@ -32,6 +32,31 @@ namespace nfd {
 namespace tools {
 namespace nfdc {
 
+CsEraseJobDataset::CsEraseJobDataset()
+  : StatusDataset("cs/erase-jobs")
+{
+}
+
+CsEraseJobDataset::ResultType
+CsEraseJobDataset::parseResult(ndn::ConstBufferPtr payload) const
+{
+  ResultType result;
+
+  size_t offset = 0;
+  while (offset < payload->size()) {
+    bool isOk = false;
+    Block block;
+    std::tie(isOk, block) = Block::fromBuffer(payload, offset);
+    if (!isOk) {
+      BOOST_THROW_EXCEPTION(ndn::tlv::Error("cannot decode Block"));
+    }
+    offset += block.size();
+    result.emplace_back(block);
+  }
+
+  return result;
+}
+
 void
 CsModule::registerCommands(CommandParser& parser)
 {
@@ -49,6 +74,23 @@ CsModule::registerCommands(CommandParser& parser)
     .addArg("prefix", ArgValueType::NAME, Required::YES, Positional::YES)
     .addArg("count", ArgValueType::UNSIGNED, Required::NO, Positional::NO);
   parser.addCommand(defCsErase, &CsModule::erase);
+
+  CommandDefinition defCsEraseStart("cs", "erase-start");
+  defCsEraseStart
+    .setTitle("start erasing cached Data in the background")
+    .addArg("prefix", ArgValueType::NAME, Required::YES, Positional::YES);
+  parser.addCommand(defCsEraseStart, &CsModule::startEraseJob);
+
+  CommandDefinition defCsEraseCancel("cs", "erase-cancel");
+  defCsEraseCancel
+    .setTitle("cancel a background erase job")
+    .addArg("prefix", ArgValueType::NAME, Required::YES, Positional::YES);
+  parser.addCommand(defCsEraseCancel, &CsModule::cancelEraseJob);
+
+  CommandDefinition defCsEraseJobs("cs", "erase-jobs");
+  defCsEraseJobs
+    .setTitle("print background erase jobs");
+  parser.addCommand(defCsEraseJobs, &CsModule::listEraseJobs);
 }
 
 void
@@ -114,6 +156,66 @@ CsModule::erase(ExecuteContext& ctx)
   ctx.face.processEvents();
 }
 
+void
+CsModule::startEraseJob(ExecuteContext& ctx)
+{
+  ControlParameters params;
+  params.setName(ctx.args.get<Name>("prefix"));
+
+  ctx.controller.start<CsEraseStartCommand>(
+    params,
+    [&] (const ControlParameters& resp) {
+      text::ItemAttributes ia;
+      ctx.out << "cs-erase-started "
+              << ia("prefix") << resp.getName()
+              << ia("erased") << resp.getCount()
+              << '\n';
+    },
+    ctx.makeCommandFailureHandler("starting CS erase job"),
+    ctx.makeCommandOptions());
+
+  ctx.face.processEvents();
+}
+
+void
+CsModule::cancelEraseJob(ExecuteContext& ctx)
+{
+  ControlParameters params;
+  params.setName(ctx.args.get<Name>("prefix"));
+
+  ctx.controller.start<CsEraseCancelCommand>(
+    params,
+    [&] (const ControlParameters& resp) {
+      text::ItemAttributes ia;
+      ctx.out << "cs-erase-canceled "
+              << ia("prefix") << resp.getName()
+              << ia("erased") << resp.getCount()
+              << '\n';
+    },
+    ctx.makeCommandFailureHandler("canceling CS erase job"),
+    ctx.makeCommandOptions());
+
+  ctx.face.processEvents();
+}
+
+void
+CsModule::listEraseJobs(ExecuteContext& ctx)
+{
+  ctx.controller.fetch<CsEraseJobDataset>(
+    [&] (const std::vector<CsEraseJob>& dataset) {
+      for (const CsEraseJob& job : dataset) {
+        text::ItemAttributes ia;
+        ctx.out << ia("prefix") << job.getName()
+                << ia("erased") << job.getNErased()
+                << '\n';
+      }
+    },
+    ctx.makeDatasetFailureHandler("CS erase jobs dataset"),
+    ctx.makeCommandOptions());
+
+  ctx.face.processEvents();
+}
+
 void
 CsModule::fetchStatus(Controller& controller,
                       const std::function<void()>& onSuccess,
@@ -28,6 +28,9 @@
 
 #include "command-parser.hpp"
 #include "module.hpp"
+#include "core/cs-erase-job.hpp"
+
+#include <ndn-cxx/mgmt/nfd/status-dataset.hpp>
 
 namespace nfd {
 namespace tools {
@@ -35,13 +38,26 @@ namespace nfdc {
 
 using ndn::nfd::CsInfo;
 
+/** \brief represents a cs/erase-jobs dataset
+ */
+class CsEraseJobDataset : public ndn::nfd::StatusDataset
+{
+public:
+  CsEraseJobDataset();
+
+  using ResultType = std::vector<CsEraseJob>;
+
+  ResultType
+  parseResult(ndn::ConstBufferPtr payload) const;
+};
+
 /** \brief provides access to NFD CS management
  *  \sa https://redmine.named-data.net/projects/nfd/wiki/CsMgmt
  */
 class CsModule : public Module, noncopyable
 {
 public:
-  /** \brief register 'cs config' command
+  /** \brief register 'cs config', 'cs erase', and background erase job commands
    */
   static void
   registerCommands(CommandParser& parser);
@@ -56,6 +72,21 @@ public:
   static void
   erase(ExecuteContext& ctx);
 
+  /** \brief the 'cs erase-start' command
+   */
+  static void
+  startEraseJob(ExecuteContext& ctx);
+
+  /** \brief the 'cs erase-cancel' command
+   */
+  static void
+  cancelEraseJob(ExecuteContext& ctx);
+
+  /** \brief the 'cs erase-jobs' command
+   */
+  static void
+  listEraseJobs(ExecuteContext& ctx);
+
   void
   fetchStatus(Controller& controller,
               const std::function<void()>& onSuccess,
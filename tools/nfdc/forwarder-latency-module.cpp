@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "forwarder-latency-module.hpp"
+#include "format-helpers.hpp"
+#include "core/latency-histogram.hpp"
+#include "core/latency-tlv.hpp"
+
+namespace nfd {
+namespace tools {
+namespace nfdc {
+
+uint64_t
+PipelineStageLatency::getQuantile(double q) const
+{
+  return LatencyHistogram::getQuantile(buckets.data(), buckets.size(), nSamples, q);
+}
+
+ForwarderLatencyDataset::ForwarderLatencyDataset()
+  : StatusDataset("status/latency")
+{
+}
+
+static PipelineStageLatency
+decodeStageLatency(const Block& block)
+{
+  if (block.type() != latency_tlv::PipelineStageLatency) {
+    BOOST_THROW_EXCEPTION(ndn::tlv::Error("expecting PipelineStageLatency block"));
+  }
+  block.parse();
+
+  PipelineStageLatency item;
+  item.stageName = ndn::encoding::readString(block.get(latency_tlv::StageName));
+  item.nSamples = ndn::encoding::readNonNegativeInteger(
+                    block.get(latency_tlv::NSamples));
+  item.totalNanoseconds = ndn::encoding::readNonNegativeInteger(
+                            block.get(latency_tlv::TotalNanoseconds));
+  for (const Block& element : block.elements()) {
+    if (element.type() == latency_tlv::BucketCount) {
+      item.buckets.push_back(ndn::encoding::readNonNegativeInteger(element));
+    }
+  }
+  return item;
+}
+
+ForwarderLatencyDataset::ResultType
+ForwarderLatencyDataset::parseResult(ndn::ConstBufferPtr payload) const
+{
+  ResultType result;
+
+  size_t offset = 0;
+  while (offset < payload->size()) {
+    bool isOk = false;
+    Block block;
+    std::tie(isOk, block) = Block::fromBuffer(payload, offset);
+    if (!isOk) {
+      BOOST_THROW_EXCEPTION(ndn::tlv::Error("cannot decode Block"));
+    }
+    offset += block.size();
+    result.push_back(decodeStageLatency(block));
+  }
+
+  return result;
+}
+
+void
+ForwarderLatencyModule::fetchStatus(Controller& controller,
+                                    const std::function<void()>& onSuccess,
+                                    const Controller::DatasetFailCallback& onFailure,
+                                    const CommandOptions& options)
+{
+  controller.fetch<ForwarderLatencyDataset>(
+    [this, onSuccess] (const std::vector<PipelineStageLatency>& result) {
+      m_status = result;
+      onSuccess();
+    },
+    onFailure, options);
+}
+
+static uint64_t
+calculateMean(const PipelineStageLatency& item)
+{
+  return item.nSamples == 0 ? 0 : item.totalNanoseconds / item.nSamples;
+}
+
+void
+ForwarderLatencyModule::formatStatusXml(std::ostream& os) const
+{
+  os << "<pipelineLatency>";
+  for (const PipelineStageLatency& item : m_status) {
+    formatItemXml(os, item);
+  }
+  os << "</pipelineLatency>";
+}
+
+void
+ForwarderLatencyModule::formatItemXml(std::ostream& os, const PipelineStageLatency& item)
+{
+  os << "<stage>";
+  os << "<name>" << xml::Text{item.stageName} << "</name>";
+  os << "<nSamples>" << item.nSamples << "</nSamples>";
+  os << "<meanNanoseconds>" << calculateMean(item) << "</meanNanoseconds>";
+  os << "<p50Nanoseconds>" << item.getQuantile(0.5) << "</p50Nanoseconds>";
+  os << "<p99Nanoseconds>" << item.getQuantile(0.99) << "</p99Nanoseconds>";
+  os << "</stage>";
+}
+
+void
+ForwarderLatencyModule::formatStatusText(std::ostream& os) const
+{
+  os << "Pipeline stage latency:\n";
+  for (const PipelineStageLatency& item : m_status) {
+    formatItemText(os, item);
+  }
+}
+
+void
+ForwarderLatencyModule::formatItemText(std::ostream& os, const PipelineStageLatency& item)
+{
+  text::ItemAttributes ia;
+  os << "  " << item.stageName << ' '
+     << ia("samples") << item.nSamples
+     << ia("mean") << calculateMean(item) << "ns"
+     << ia("p50") << item.getQuantile(0.5) << "ns"
+     << ia("p99") << item.getQuantile(0.99) << "ns"
+     << ia.end()
+     << '\n';
+}
+
+} // namespace nfdc
+} // namespace tools
+} // namespace nfd
@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_TOOLS_NFDC_FORWARDER_LATENCY_MODULE_HPP
+#define NFD_TOOLS_NFDC_FORWARDER_LATENCY_MODULE_HPP
+
+#include "module.hpp"
+
+#include <ndn-cxx/mgmt/nfd/status-dataset.hpp>
+
+namespace nfd {
+namespace tools {
+namespace nfdc {
+
+/** \brief processing latency of a forwarding pipeline stage
+ */
+struct PipelineStageLatency
+{
+  std::string stageName;
+  uint64_t nSamples = 0;
+  uint64_t totalNanoseconds = 0;
+  std::vector<uint64_t> buckets; ///< bucket i counts samples in [2^i, 2^(i+1)) nanoseconds
+
+  /** \return an upper bound of quantile \p q of the samples, in nanoseconds
+   *  \retval 0 there is no sample
+   */
+  uint64_t
+  getQuantile(double q) const;
+};
+
+/** \brief represents a status/latency dataset
+ */
+class ForwarderLatencyDataset : public ndn::nfd::StatusDataset
+{
+public:
+  ForwarderLatencyDataset();
+
+  using ResultType = std::vector<PipelineStageLatency>;
+
+  ResultType
+  parseResult(ndn::ConstBufferPtr payload) const;
+};
+
+/** \brief provides access to per-stage latency of NFD forwarding pipelines
+ */
+class ForwarderLatencyModule : public Module, noncopyable
+{
+public:
+  void
+  fetchStatus(Controller& controller,
+              const std::function<void()>& onSuccess,
+              const Controller::DatasetFailCallback& onFailure,
+              const CommandOptions& options) override;
+
+  void
+  formatStatusXml(std::ostream& os) const override;
+
+  /** \brief format a single status item as XML
+   *  \param os output stream
+   *  \param item status item
+   */
+  static void
+  formatItemXml(std::ostream& os, const PipelineStageLatency& item);
+
+  void
+  formatStatusText(std::ostream& os) const override;
+
+  /** \brief format a single status item as text
+   *  \param os output stream
+   *  \param item status item
+   */
+  static void
+  formatItemText(std::ostream& os, const PipelineStageLatency& item);
+
+private:
+  std::vector<PipelineStageLatency> m_status;
+};
+
+} // namespace nfdc
+} // namespace tools
+} // namespace nfd
+
+#endif // NFD_TOOLS_NFDC_FORWARDER_LATENCY_MODULE_HPP
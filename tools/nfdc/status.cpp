@@ -25,6 +25,7 @@
 
 #include "status.hpp"
 #include "forwarder-general-module.hpp"
+#include "forwarder-latency-module.hpp"
 #include "channel-module.hpp"
 #include "face-module.hpp"
 #include "fib-module.hpp"
@@ -47,6 +48,10 @@ reportStatus(ExecuteContext& ctx, const StatusReportOptions& options)
     report.sections.push_back(make_unique<ForwarderGeneralModule>());
   }
 
+  if (options.wantForwarderLatency) {
+    report.sections.push_back(make_unique<ForwarderLatencyModule>());
+  }
+
   if (options.wantChannels) {
     report.sections.push_back(make_unique<ChannelModule>());
   }
@@ -111,8 +116,9 @@ reportStatusComprehensive(ExecuteContext& ctx)
 {
   StatusReportOptions options;
   options.output = ctx.args.get<ReportFormat>("format", ReportFormat::TEXT);
-  options.wantForwarderGeneral = options.wantChannels = options.wantFaces = options.wantFib =
-    options.wantRib = options.wantCs = options.wantStrategyChoice = true;
+  options.wantForwarderGeneral = options.wantForwarderLatency = options.wantChannels =
+    options.wantFaces = options.wantFib = options.wantRib = options.wantCs =
+    options.wantStrategyChoice = true;
   reportStatus(ctx, options);
 }
 
@@ -131,6 +137,11 @@ registerStatusCommands(CommandParser& parser)
   parser.addCommand(defStatusShow, bind(&reportStatusSingleSection, _1, &StatusReportOptions::wantForwarderGeneral));
   parser.addAlias("status", "show", "");
 
+  CommandDefinition defStatusLatency("status", "latency");
+  defStatusLatency
+    .setTitle("print forwarding pipeline latency");
+  parser.addCommand(defStatusLatency, bind(&reportStatusSingleSection, _1, &StatusReportOptions::wantForwarderLatency));
+
   CommandDefinition defChannelList("channel", "list");
   defChannelList
     .setTitle("print channel list");
@@ -37,6 +37,7 @@ struct StatusReportOptions
 {
   ReportFormat output = ReportFormat::TEXT;
   bool wantForwarderGeneral = false;
+  bool wantForwarderLatency = false;
   bool wantChannels = false;
   bool wantFaces = false;
   bool wantFib = false;